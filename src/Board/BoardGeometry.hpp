@@ -0,0 +1,181 @@
+#ifndef __BOARDGEOMETRY_H__
+#define __BOARDGEOMETRY_H__
+
+#include "TileMask.hpp"
+#include "Util/GlobalDefinitions.hpp"
+
+#include <array>
+#include <cstdint>
+
+// Static shape of the 9x9 board. Tiles are indexed row-major (row * 9 + col) and regions are indexed in
+// the same order used by Solver::getAllRegions: subgrids (0-8), horizontal lines (9-17) and vertical
+// lines (18-26).
+namespace BoardGeometry
+{
+using TileIndex = std::uint8_t;
+using RegionIndex = std::uint8_t;
+using RegionTiles = std::array<TileIndex, 9>;
+// set of regions: bit i represents the region with index i
+using RegionMask = std::uint32_t;
+// bit i is set when the region at position i of TILE_REGIONS is shared by both tiles
+using CommonRegionsMask = std::uint8_t;
+
+constexpr TileIndex TILES_COUNT = 81;
+constexpr RegionIndex REGIONS_COUNT = 27;
+
+constexpr RegionIndex SUBGRIDS_OFFSET = 0;
+constexpr RegionIndex HORIZONTAL_LINES_OFFSET = 9;
+constexpr RegionIndex VERTICAL_LINES_OFFSET = 18;
+
+constexpr RegionMask ALL_REGIONS_MASK = (RegionMask{1} << REGIONS_COUNT) - 1;
+constexpr RegionMask SUBGRIDS_MASK = ((RegionMask{1} << 9) - 1) << SUBGRIDS_OFFSET;
+constexpr RegionMask LINES_MASK = ALL_REGIONS_MASK & ~SUBGRIDS_MASK;
+
+constexpr TileIndex toTileIndex(const TileValueType row, const TileValueType col)
+{
+    return static_cast<TileIndex>(row * 9 + col);
+}
+
+constexpr TileIndex toTileIndex(const Coordinates& coordinates)
+{
+    return toTileIndex(coordinates.row, coordinates.col);
+}
+
+constexpr TileValueType getRow(const TileIndex tileIndex)
+{
+    return tileIndex / 9;
+}
+
+constexpr TileValueType getCol(const TileIndex tileIndex)
+{
+    return tileIndex % 9;
+}
+
+constexpr TileValueType getSubgrid(const TileIndex tileIndex)
+{
+    return (getRow(tileIndex) / 3) * 3 + getCol(tileIndex) / 3;
+}
+
+constexpr Coordinates toCoordinates(const TileIndex tileIndex)
+{
+    return Coordinates{getRow(tileIndex), getCol(tileIndex)};
+}
+
+constexpr RegionIndex toRegionIndex(const RegionSpecificType type, const TileValueType index)
+{
+    switch (type)
+    {
+    case RegionSpecificType::SUBGRID: return static_cast<RegionIndex>(SUBGRIDS_OFFSET + index);
+    case RegionSpecificType::HORIZONTAL_LINE:
+        return static_cast<RegionIndex>(HORIZONTAL_LINES_OFFSET + index);
+    case RegionSpecificType::VERTICAL_LINE: return static_cast<RegionIndex>(VERTICAL_LINES_OFFSET + index);
+    default: return REGIONS_COUNT;
+    }
+}
+
+namespace detail
+{
+constexpr std::array<RegionTiles, REGIONS_COUNT> buildRegionTiles()
+{
+    std::array<RegionTiles, REGIONS_COUNT> regionTiles{};
+    for (TileValueType index = 0; index < 9; ++index)
+    {
+        for (TileValueType i = 0; i < 9; ++i)
+        {
+            const auto subgridRow = static_cast<TileValueType>((index / 3) * 3 + i / 3);
+            const auto subgridCol = static_cast<TileValueType>((index % 3) * 3 + i % 3);
+            regionTiles[SUBGRIDS_OFFSET + index][i] = toTileIndex(subgridRow, subgridCol);
+            regionTiles[HORIZONTAL_LINES_OFFSET + index][i] = toTileIndex(index, i);
+            regionTiles[VERTICAL_LINES_OFFSET + index][i] = toTileIndex(i, index);
+        }
+    }
+    return regionTiles;
+}
+
+constexpr std::array<std::array<RegionIndex, 3>, TILES_COUNT> buildTileRegions()
+{
+    std::array<std::array<RegionIndex, 3>, TILES_COUNT> tileRegions{};
+    for (TileIndex tileIndex = 0; tileIndex < TILES_COUNT; ++tileIndex)
+    {
+        tileRegions[tileIndex] = {
+            static_cast<RegionIndex>(HORIZONTAL_LINES_OFFSET + getRow(tileIndex)),
+            static_cast<RegionIndex>(VERTICAL_LINES_OFFSET + getCol(tileIndex)),
+            static_cast<RegionIndex>(SUBGRIDS_OFFSET + getSubgrid(tileIndex)),
+        };
+    }
+    return tileRegions;
+}
+
+constexpr std::array<TileMask, REGIONS_COUNT> buildRegionMasks()
+{
+    const auto regionTiles = buildRegionTiles();
+    std::array<TileMask, REGIONS_COUNT> regionMasks{};
+    for (RegionIndex regionIndex = 0; regionIndex < REGIONS_COUNT; ++regionIndex)
+    {
+        for (const auto tileIndex : regionTiles[regionIndex]) { regionMasks[regionIndex].insert(tileIndex); }
+    }
+    return regionMasks;
+}
+
+constexpr std::array<TileMask, TILES_COUNT> buildPeers()
+{
+    const auto regionMasks = buildRegionMasks();
+    const auto tileRegions = buildTileRegions();
+    std::array<TileMask, TILES_COUNT> peers{};
+    for (TileIndex tileIndex = 0; tileIndex < TILES_COUNT; ++tileIndex)
+    {
+        for (const auto regionIndex : tileRegions[tileIndex])
+        {
+            peers[tileIndex] |= regionMasks[regionIndex];
+        }
+        peers[tileIndex].erase(tileIndex);
+    }
+    return peers;
+}
+
+constexpr std::array<std::array<CommonRegionsMask, TILES_COUNT>, TILES_COUNT> buildCommonRegions()
+{
+    const auto tileRegions = buildTileRegions();
+    std::array<std::array<CommonRegionsMask, TILES_COUNT>, TILES_COUNT> commonRegions{};
+    for (TileIndex first = 0; first < TILES_COUNT; ++first)
+    {
+        for (TileIndex second = 0; second < TILES_COUNT; ++second)
+        {
+            for (size_t i = 0; i < 3; ++i)
+            {
+                if (tileRegions[first][i] == tileRegions[second][i])
+                {
+                    commonRegions[first][second] |= static_cast<CommonRegionsMask>(1u << i);
+                }
+            }
+        }
+    }
+    return commonRegions;
+}
+} // namespace detail
+
+// tiles of each region, in the same order they are iterated by the Region objects
+inline constexpr std::array<RegionTiles, REGIONS_COUNT> REGION_TILES = detail::buildRegionTiles();
+
+// regions of each tile, in the same order returned by Tile::getRegions (horizontal line, vertical line,
+// subgrid)
+inline constexpr std::array<std::array<RegionIndex, 3>, TILES_COUNT> TILE_REGIONS =
+    detail::buildTileRegions();
+
+// tiles of each region
+inline constexpr std::array<TileMask, REGIONS_COUNT> REGION_MASKS = detail::buildRegionMasks();
+
+// the 20 tiles that share at least one region with each tile (the tile itself is not included)
+inline constexpr std::array<TileMask, TILES_COUNT> PEERS = detail::buildPeers();
+
+// regions shared by each pair of tiles
+inline constexpr std::array<std::array<CommonRegionsMask, TILES_COUNT>, TILES_COUNT> COMMON_REGIONS =
+    detail::buildCommonRegions();
+
+constexpr const RegionTiles& getRegionTiles(const RegionSpecificType type, const TileValueType index)
+{
+    return REGION_TILES[toRegionIndex(type, index)];
+}
+} // namespace BoardGeometry
+
+#endif // __BOARDGEOMETRY_H__
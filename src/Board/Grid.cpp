@@ -5,8 +5,10 @@
 #include "Tile.hpp"
 
 #include <fmt/format.h>
+#include <algorithm>
 #include <iostream>
 #include <string>
+#include <typeinfo>
 #include <vector>
 
 std::shared_ptr<Tile>
@@ -26,38 +28,36 @@ std::shared_ptr<Subgrid> DefaultComponentsConstructor::createSubgrid(Grid* grid,
     return std::make_shared<Subgrid>(grid, index);
 }
 
-std::shared_ptr<Tile> DefaultComponentsConstructor::createTileCopy(Grid* grid,
-                                                                   const std::shared_ptr<Tile>& tile) const
+Grid::Grid(std::shared_ptr<ComponentsConstructor>&& constructor)
+    : m_constructor(std::move(constructor))
 {
-    return std::make_shared<Tile>(*tile, grid);
-}
+    createComponents();
 
-std::shared_ptr<Line> DefaultComponentsConstructor::createLineCopy(Grid* grid,
-                                                                   const std::shared_ptr<Line>& line) const
-{
-    return std::make_shared<Line>(*line, grid);
-}
-std::shared_ptr<Subgrid>
-DefaultComponentsConstructor::createSubgridCopy(Grid* grid, const std::shared_ptr<Subgrid>& subgrid) const
-{
-    return std::make_shared<Subgrid>(*subgrid, grid);
+    m_gridPrinter = std::make_unique<GridPrinter>(*this);
 }
 
-Grid::Grid(std::shared_ptr<ComponentsConstructor>&& constructor)
-    : m_constructor(std::move(constructor))
+void Grid::createComponents()
 {
     for (TileValueType row = 0; row < 9; ++row)
         for (TileValueType col = 0; col < 9; ++col)
             m_gridTiles(row, col) = m_constructor->createTile(this, row, col);
 
+    bindTilesToState();
+
+    m_verticalLines.clear();
+    m_horizontalLines.clear();
+    m_subgrids.clear();
     for (TileValueType i = 0; i < 9; i++)
     {
         m_verticalLines.emplace_back(m_constructor->createLine(this, LineOrientation::VERTICAL, i));
         m_horizontalLines.emplace_back(m_constructor->createLine(this, LineOrientation::HORIZONTAL, i));
         m_subgrids.emplace_back(m_constructor->createSubgrid(this, i));
     }
+}
 
-    m_gridPrinter = std::make_unique<GridPrinter>(*this);
+void Grid::bindTilesToState()
+{
+    for (const auto& tile : m_gridTiles) { tile->setValueStorage(&m_gridState.values[tile->getIndex()]); }
 }
 
 Grid::Grid(const std::string& boardStr, std::shared_ptr<ComponentsConstructor>&& constructor)
@@ -76,27 +76,18 @@ Grid::Grid(const std::string& boardStr, std::shared_ptr<ComponentsConstructor>&&
 }
 
 Grid::Grid(const Grid& other)
+    : Grid(std::shared_ptr<ComponentsConstructor>(other.m_constructor))
 {
-    m_constructor = other.m_constructor;
-
-    for (TileValueType row = 0; row < 9; ++row)
-        for (TileValueType col = 0; col < 9; ++col)
-            m_gridTiles(row, col) = m_constructor->createTileCopy(this, other.m_gridTiles(row, col));
-
-    for (TileValueType i = 0; i < 9; i++)
-    {
-        m_verticalLines.emplace_back(m_constructor->createLineCopy(this, other.m_verticalLines[i]));
-        m_horizontalLines.emplace_back(m_constructor->createLineCopy(this, other.m_horizontalLines[i]));
-        m_subgrids.emplace_back(m_constructor->createSubgridCopy(this, other.m_subgrids[i]));
-    }
-
-    m_gridPrinter = std::make_unique<GridPrinter>(*this);
+    m_gridState = other.m_gridState;
 }
 
 Grid::Grid(Grid&& other)
 {
+    m_gridState = other.m_gridState;
+
     m_gridTiles = std::move(other.m_gridTiles);
     for (const auto& tile : m_gridTiles) tile->setGrid(this);
+    bindTilesToState();
 
     m_verticalLines = std::move(other.m_verticalLines);
     for (const auto& line : m_verticalLines) line->setGrid(this);
@@ -116,18 +107,15 @@ Grid& Grid::operator=(const Grid& other)
 {
     if (this == &other)
         return *this;
-    m_constructor = other.m_constructor;
-
-    for (TileValueType row = 0; row < 9; ++row)
-        for (TileValueType col = 0; col < 9; ++col)
-            m_gridTiles(row, col) = m_constructor->createTileCopy(this, other.m_gridTiles(row, col));
 
-    for (TileValueType i = 0; i < 9; i++)
+    // the components only have to be recreated if they are of a different type, otherwise they are
+    // already views over m_gridState and copying the state is enough
+    if (typeid(*m_constructor) != typeid(*other.m_constructor))
     {
-        m_verticalLines[i] = m_constructor->createLineCopy(this, other.m_verticalLines[i]);
-        m_horizontalLines[i] = m_constructor->createLineCopy(this, other.m_horizontalLines[i]);
-        m_subgrids[i] = m_constructor->createSubgridCopy(this, other.m_subgrids[i]);
+        m_constructor = other.m_constructor;
+        createComponents();
     }
+    m_gridState = other.m_gridState;
 
     return *this;
 }
@@ -137,8 +125,11 @@ Grid& Grid::operator=(Grid&& other)
     if (this == &other)
         return *this;
 
+    m_gridState = other.m_gridState;
+
     m_gridTiles = std::move(other.m_gridTiles);
     for (const auto& tile : m_gridTiles) tile->setGrid(this);
+    bindTilesToState();
 
     m_verticalLines = std::move(other.m_verticalLines);
     for (const auto& line : m_verticalLines) line->setGrid(this);
@@ -179,6 +170,11 @@ std::string Grid::getBoardString() const
     return m_gridPrinter->createBoardString();
 }
 
+std::string Grid::getValuesString() const
+{
+    return toValuesString(m_gridState);
+}
+
 std::vector<std::string> Grid::requestTileDisplayStringForCoordinate(const TileValueType row,
                                                                      const TileValueType col) const
 {
@@ -213,12 +209,9 @@ void Grid::printGridDebug() const
 
 bool Grid::isSolved() const
 {
-    for (const auto& tile : m_gridTiles)
-    {
-        if (!tile->hasValue())
-            return false;
-    }
-    return true;
+    return std::none_of(m_gridState.values.begin(), m_gridState.values.end(), [](const TileValueType value) {
+        return value == 0;
+    });
 }
 
 GridTiles& Grid::getGridTiles()
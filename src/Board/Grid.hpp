@@ -2,6 +2,7 @@
 #define __GRID_H__
 
 #include "ElementsContainer.hpp"
+#include "GridState.hpp"
 #include "Util/GlobalDefinitions.hpp"
 
 #include <memory>
@@ -19,11 +20,6 @@ class ComponentsConstructor
     virtual std::shared_ptr<Line> createLine(Grid* grid, LineOrientation row, short index) const = 0;
     virtual std::shared_ptr<Subgrid> createSubgrid(Grid* grid, short index) const = 0;
 
-    virtual std::shared_ptr<Tile> createTileCopy(Grid* grid, const std::shared_ptr<Tile>& tile) const = 0;
-    virtual std::shared_ptr<Line> createLineCopy(Grid* grid, const std::shared_ptr<Line>& line) const = 0;
-    virtual std::shared_ptr<Subgrid> createSubgridCopy(Grid* grid,
-                                                       const std::shared_ptr<Subgrid>& subgrid) const = 0;
-
     virtual ~ComponentsConstructor() = default;
 };
 
@@ -33,16 +29,13 @@ class DefaultComponentsConstructor : public ComponentsConstructor
     std::shared_ptr<Tile> createTile(Grid* grid, TileValueType row, TileValueType col) const override;
     std::shared_ptr<Line> createLine(Grid* grid, LineOrientation row, short index) const override;
     std::shared_ptr<Subgrid> createSubgrid(Grid* grid, short index) const override;
-
-    std::shared_ptr<Tile> createTileCopy(Grid* grid, const std::shared_ptr<Tile>& tile) const override;
-    std::shared_ptr<Line> createLineCopy(Grid* grid, const std::shared_ptr<Line>& line) const override;
-    std::shared_ptr<Subgrid> createSubgridCopy(Grid* grid,
-                                               const std::shared_ptr<Subgrid>& subgrid) const override;
 };
 
 class Grid
 {
   private:
+    GridState m_gridState;
+
     GridTiles m_gridTiles;
     std::vector<std::shared_ptr<Line>> m_verticalLines;
     std::vector<std::shared_ptr<Line>> m_horizontalLines;
@@ -50,13 +43,17 @@ class Grid
 
     std::shared_ptr<ComponentsConstructor> m_constructor;
 
+    void createComponents();
+    void bindTilesToState();
+
     friend class Solver;
     friend class GridPrinter;
-    friend int main();
 
   public:
     void print() const;
     std::string getBoardString() const;
+    // see toValuesString
+    std::string getValuesString() const;
 
   protected:
     virtual std::vector<std::string> requestTileDisplayStringForCoordinate(const TileValueType row,
@@ -80,6 +77,9 @@ class Grid
          std::shared_ptr<ComponentsConstructor>&& constructor =
              std::make_shared<DefaultComponentsConstructor>());
 
+    // a new Grid needs its own tiles and regions bound to its state, so copy-constructing one builds the
+    // whole component graph. Copies between existing Grids (operator= or setGridState, and
+    // Solver::getState/setState) only copy the state
     Grid(const Grid& other);
     Grid(Grid&& other);
     Grid& operator=(const Grid& other);
@@ -107,6 +107,11 @@ class Grid
 
     const std::shared_ptr<ComponentsConstructor>& getComponentsConstructor() const;
 
+    // The whole board lives in a single trivially copyable block: moving a board to another Grid (for
+    // example, one owned by another thread) is just a copy of it
+    const GridState& getGridState() const { return m_gridState; }
+    void setGridState(const GridState& gridState) { m_gridState = gridState; }
+
     bool isSolved() const;
 };
 
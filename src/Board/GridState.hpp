@@ -0,0 +1,34 @@
+#ifndef __GRIDSTATE_H__
+#define __GRIDSTATE_H__
+
+#include "BoardGeometry.hpp"
+#include "Util/GlobalDefinitions.hpp"
+
+#include <array>
+#include <string>
+#include <type_traits>
+
+// Every value of a Grid, stored contiguously and indexed as described in BoardGeometry. The Tiles of a
+// Grid only read and write their value here, so copying a board is a plain copy of this block.
+struct GridState
+{
+    std::array<TileValueType, BoardGeometry::TILES_COUNT> values{};
+};
+
+static_assert(std::is_trivially_copyable_v<GridState>);
+
+// 81 characters, one per tile in row-major order, with '.' for the tiles without value
+inline std::string toValuesString(const GridState& gridState)
+{
+    std::string result(gridState.values.size(), '.');
+    for (size_t i = 0; i < gridState.values.size(); ++i)
+    {
+        if (gridState.values[i] != 0)
+        {
+            result[i] = static_cast<char>('0' + gridState.values[i]);
+        }
+    }
+    return result;
+}
+
+#endif // __GRIDSTATE_H__
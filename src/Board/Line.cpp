@@ -1,6 +1,4 @@
 #include "Line.hpp"
-#include "ElementList.hpp"
-#include "ElementWrapper.hpp"
 #include "Grid.hpp"
 #include "Tile.hpp"
 #include <utility>
@@ -9,12 +7,11 @@ Line::Line(Grid* grid, LineOrientation orientation, const short index)
     : Region(index, RegionType::LINE, grid)
     , m_orientation(orientation)
 {
-
-    const auto lamb = [&](const std::shared_ptr<Tile>& tile) {
-        tile->setLine(orientation, this);
-    };
-
-    m_elementList = Region::make_line(orientation, index, grid->getGridTiles(), lamb);
+    const auto type = orientation == LineOrientation::HORIZONTAL ? RegionSpecificType::HORIZONTAL_LINE
+                                                                 : RegionSpecificType::VERTICAL_LINE;
+    const auto& tileIndexes = BoardGeometry::getRegionTiles(type, static_cast<TileValueType>(index));
+    initializeTiles(tileIndexes, grid->getGridTiles());
+    for (const auto& tile : m_tiles) { tile->setLine(orientation, this); }
 }
 
 Line::Line(Line&& other)
@@ -23,13 +20,7 @@ Line::Line(Line&& other)
     m_index = other.m_index;
     m_orientation = other.m_orientation;
 
-    auto* ptr = m_elementList->getHead();
-    while (ptr)
-    {
-        auto& tile = ptr->getElement();
-        tile->setLine(m_orientation, this);
-        ptr = ptr->next();
-    }
+    for (const auto& tile : m_tiles) { tile->setLine(m_orientation, this); }
 }
 
 Line& Line::operator=(Line&& other)
@@ -42,13 +33,7 @@ Line& Line::operator=(Line&& other)
     m_index = other.m_index;
     m_orientation = other.m_orientation;
 
-    auto* ptr = m_elementList->getHead();
-    while (ptr)
-    {
-        auto& tile = ptr->getElement();
-        tile->setLine(m_orientation, this);
-        ptr = ptr->next();
-    }
+    for (const auto& tile : m_tiles) { tile->setLine(m_orientation, this); }
 
     return *this;
 }
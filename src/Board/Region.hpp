@@ -2,12 +2,10 @@
 #define __REGION_H__
 
 #include <algorithm>
-#include <functional>
+#include <array>
 #include <memory>
-#include <optional>
-#include <set>
 
-#include "ElementList.hpp"
+#include "BoardGeometry.hpp"
 #include "ElementsContainer.hpp"
 #include "Util/GlobalDefinitions.hpp"
 
@@ -20,16 +18,23 @@ class Region
         SUBGRID
     };
 
+    // the 9 tiles of the region, in the order given by BoardGeometry::REGION_TILES
+    using Tiles = std::array<std::shared_ptr<Tile>, 9>;
+
     virtual RegionSpecificType getRegionSpecificType() const = 0;
 
   private:
     Grid* m_grid;
 
   protected:
-    std::shared_ptr<ElementList<std::shared_ptr<Tile>>> m_elementList;
+    Tiles m_tiles;
+    BoardGeometry::RegionTiles m_tileIndexes{};
     short m_index;
     RegionType m_type;
 
+    // takes the tiles of the grid with the given indexes
+    void initializeTiles(const BoardGeometry::RegionTiles& tileIndexes, const GridTiles& gridTiles);
+
   public:
     Region(const short index, const RegionType regionType, Grid* grid);
     Region(const Region& other) = delete;
@@ -38,10 +43,9 @@ class Region
     Region& operator=(Region&& other) = default;
     virtual ~Region() = default;
 
-    const std::shared_ptr<ElementList<std::shared_ptr<Tile>>>& getElementList() const;
-    void setElementList(const std::shared_ptr<ElementList<std::shared_ptr<Tile>>>& elementList);
-
-    const ElementList<std::shared_ptr<Tile>>& getTiles() const;
+    const Tiles& getTiles() const { return m_tiles; }
+    // indexes of the tiles of the region in the grid (see BoardGeometry)
+    const BoardGeometry::RegionTiles& getTileIndexes() const { return m_tileIndexes; }
 
     short getIndex() const;
     RegionType getType() const;
@@ -53,23 +57,12 @@ class Region
 
     bool isCompleted() const;
 
-    typename ElementList<std::shared_ptr<Tile>>::iterator begin();
-    typename ElementList<std::shared_ptr<Tile>>::iterator end();
-    typename ElementList<std::shared_ptr<Tile>>::const_iterator cbegin() const;
-    typename ElementList<std::shared_ptr<Tile>>::const_iterator cend() const;
-    typename ElementList<std::shared_ptr<Tile>>::const_iterator begin() const;
-    typename ElementList<std::shared_ptr<Tile>>::const_iterator end() const;
-
-    static std::shared_ptr<ElementList<std::shared_ptr<Tile>>>
-    make_line(LineOrientation orientation,
-              TileValueType index,
-              GridTiles& gridElements,
-              const std::optional<const std::function<void(const std::shared_ptr<Tile>&)>>& applyElement);
-
-    static std::shared_ptr<ElementList<std::shared_ptr<Tile>>>
-    make_subgrid(TileValueType index,
-                 GridTiles& gridElements,
-                 const std::optional<const std::function<void(const std::shared_ptr<Tile>&)>>& applyElement);
+    Tiles::iterator begin() { return m_tiles.begin(); }
+    Tiles::iterator end() { return m_tiles.end(); }
+    Tiles::const_iterator cbegin() const { return m_tiles.cbegin(); }
+    Tiles::const_iterator cend() const { return m_tiles.cend(); }
+    Tiles::const_iterator begin() const { return m_tiles.begin(); }
+    Tiles::const_iterator end() const { return m_tiles.end(); }
 };
 
 #endif // __REGION_H__
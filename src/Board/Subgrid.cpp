@@ -1,7 +1,5 @@
 #include "Subgrid.hpp"
 
-#include "ElementList.hpp"
-#include "ElementWrapper.hpp"
 #include "Grid.hpp"
 #include "Tile.hpp"
 #include <utility>
@@ -9,10 +7,10 @@
 Subgrid::Subgrid(Grid* grid, const short index)
     : Region(index, RegionType::SUBGRID, grid)
 {
-    const auto lambda = [&](const std::shared_ptr<Tile>& tile) {
-        tile->setSubgrid(this);
-    };
-    m_elementList = Region::make_subgrid(index, grid->getGridTiles(), lambda);
+    const auto& tileIndexes =
+        BoardGeometry::getRegionTiles(RegionSpecificType::SUBGRID, static_cast<TileValueType>(index));
+    initializeTiles(tileIndexes, grid->getGridTiles());
+    for (const auto& tile : m_tiles) { tile->setSubgrid(this); }
 }
 
 Subgrid::Subgrid(Subgrid&& other)
@@ -20,12 +18,7 @@ Subgrid::Subgrid(Subgrid&& other)
 {
     m_index = other.m_index;
 
-    auto* head = m_elementList->getHead();
-    do {
-        head->getElement()->setSubgrid(this);
-    } while ((head = head->next()));
-
-    other.m_elementList = nullptr;
+    for (const auto& tile : m_tiles) { tile->setSubgrid(this); }
 }
 
 Subgrid& Subgrid::operator=(Subgrid&& other)
@@ -37,12 +30,7 @@ Subgrid& Subgrid::operator=(Subgrid&& other)
 
     m_index = other.m_index;
 
-    auto head = m_elementList->getHead();
-    do {
-        head->getElement()->setSubgrid(this);
-    } while ((head = head->next()));
-
-    other.m_elementList = nullptr;
+    for (const auto& tile : m_tiles) { tile->setSubgrid(this); }
 
     return *this;
 }
@@ -53,8 +41,7 @@ Subgrid::Subgrid(const Subgrid& other, Grid* grid)
 
 const std::shared_ptr<Tile> Subgrid::getTile(const TileValueType row, const TileValueType col) const
 {
-    const auto first = m_elementList->cbegin();
-    return *std::next(first, row * 3 + col);
+    return m_tiles[row * 3 + col];
 }
 
 const std::shared_ptr<Tile> Subgrid::operator()(const TileValueType row, const TileValueType col) const
@@ -7,14 +7,14 @@
 Tile::Tile(Grid* grid, Coordinates coordinates, const TileValueType value)
     : m_grid(grid)
     , m_coordinates(coordinates)
-    , m_value(value)
+    , m_detachedValue(value)
 {}
 
 Tile::Tile(const Tile& other)
 {
     m_grid = nullptr;
     m_coordinates = other.m_coordinates;
-    m_value = other.m_value;
+    m_detachedValue = other.getValue();
     m_horizontalLine = nullptr;
     m_verticalLine = nullptr;
     m_subgrid = nullptr;
@@ -24,7 +24,7 @@ Tile::Tile(const Tile& other, Grid* grid)
 {
     m_grid = grid;
     m_coordinates = other.m_coordinates;
-    m_value = other.m_value;
+    m_detachedValue = other.getValue();
     m_horizontalLine = nullptr;
     m_verticalLine = nullptr;
     m_subgrid = nullptr;
@@ -35,19 +35,29 @@ const Coordinates& Tile::getCoordinates() const
     return m_coordinates;
 }
 
+BoardGeometry::TileIndex Tile::getIndex() const
+{
+    return BoardGeometry::toTileIndex(m_coordinates);
+}
+
+void Tile::setValueStorage(TileValueType* valueStorage)
+{
+    m_value = valueStorage;
+}
+
 void Tile::setValue(const TileValueType value)
 {
-    m_value = value;
+    *m_value = value;
 }
 
 TileValueType Tile::getValue() const
 {
-    return m_value;
+    return *m_value;
 }
 
 bool Tile::hasValue() const
 {
-    return m_value != 0;
+    return *m_value != 0;
 }
 
 void Tile::setLine(LineOrientation orientation, Line* line)
@@ -109,7 +119,7 @@ std::array<Region*, 3> Tile::getRegions() const
 
 bool Tile::operator==(const TileValueType value) const
 {
-    return m_value == value;
+    return *m_value == value;
 }
 
 Tile& Tile::operator=(const TileValueType value)
@@ -1,6 +1,7 @@
 #ifndef __TILE_H__
 #define __TILE_H__
 
+#include "BoardGeometry.hpp"
 #include "Util/GlobalDefinitions.hpp"
 
 #include <array>
@@ -17,7 +18,10 @@ class Tile
     Grid* m_grid;
     Coordinates m_coordinates;
 
-    TileValueType m_value;
+    // a Tile owned by a Grid keeps its value in the GridState of that Grid. m_detachedValue is only
+    // used by tiles that were not bound to a Grid (setValueStorage), such as copies
+    TileValueType m_detachedValue;
+    TileValueType* m_value{&m_detachedValue};
 
     mutable Line* m_horizontalLine{nullptr};
     mutable Line* m_verticalLine{nullptr};
@@ -55,6 +59,9 @@ class Tile
     std::array<Region*, 3> getRegions() const;
 
     const Coordinates& getCoordinates() const;
+    BoardGeometry::TileIndex getIndex() const;
+
+    void setValueStorage(TileValueType* valueStorage);
 
     virtual void setValue(const TileValueType value);
     TileValueType getValue() const;
@@ -0,0 +1,165 @@
+#ifndef __TILEMASK_H__
+#define __TILEMASK_H__
+
+#include <bit>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+
+// Set of tiles of the board, stored as an 81-bit mask split in two words: bit i represents the tile with
+// index i (see BoardGeometry). Like Suggestions, every operation is a handful of bitwise instructions.
+class TileMask
+{
+  public:
+    using WordType = std::uint64_t;
+    using IndexType = std::uint8_t;
+
+    static constexpr WordType HIGH_WORD_MASK = (WordType{1} << (81 - 64)) - 1;
+
+    // iterates over the tile indexes contained in the set, in ascending order
+    struct const_iterator
+    {
+        using iterator_category = std::forward_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+        using value_type = IndexType;
+        using pointer = const IndexType*;
+        using reference = IndexType;
+
+        constexpr const_iterator() = default;
+        constexpr const_iterator(WordType low, WordType high)
+            : m_low(low)
+            , m_high(high)
+        {}
+
+        constexpr reference operator*() const
+        {
+            return m_low != 0 ? static_cast<IndexType>(std::countr_zero(m_low))
+                              : static_cast<IndexType>(64 + std::countr_zero(m_high));
+        }
+
+        constexpr const_iterator& operator++()
+        {
+            // clears the lowest set bit
+            if (m_low != 0)
+            {
+                m_low &= m_low - 1;
+            }
+            else
+            {
+                m_high &= m_high - 1;
+            }
+            return *this;
+        }
+
+        constexpr const_iterator operator++(int)
+        {
+            const_iterator tmp = *this;
+            ++(*this);
+            return tmp;
+        }
+
+        constexpr bool operator==(const const_iterator& r) const
+        {
+            return m_low == r.m_low && m_high == r.m_high;
+        }
+        constexpr bool operator!=(const const_iterator& r) const { return !(*this == r); }
+
+      private:
+        WordType m_low{0};
+        WordType m_high{0};
+    };
+
+    using iterator = const_iterator;
+
+    constexpr TileMask() = default;
+    constexpr TileMask(std::initializer_list<IndexType> indexes)
+    {
+        for (const auto index : indexes) { insert(index); }
+    }
+
+    static constexpr TileMask allTiles()
+    {
+        TileMask result;
+        result.m_low = ~WordType{0};
+        result.m_high = HIGH_WORD_MASK;
+        return result;
+    }
+
+    constexpr bool contains(const IndexType index) const
+    {
+        return index < 64 ? (m_low >> index) & 1 : (m_high >> (index - 64)) & 1;
+    }
+
+    constexpr void insert(const IndexType index)
+    {
+        if (index < 64)
+        {
+            m_low |= WordType{1} << index;
+        }
+        else
+        {
+            m_high |= WordType{1} << (index - 64);
+        }
+    }
+
+    constexpr void erase(const IndexType index)
+    {
+        if (index < 64)
+        {
+            m_low &= ~(WordType{1} << index);
+        }
+        else
+        {
+            m_high &= ~(WordType{1} << (index - 64));
+        }
+    }
+
+    constexpr unsigned short size() const
+    {
+        return static_cast<unsigned short>(std::popcount(m_low) + std::popcount(m_high));
+    }
+    constexpr bool empty() const { return m_low == 0 && m_high == 0; }
+
+    constexpr const_iterator begin() const { return const_iterator(m_low, m_high); }
+    constexpr const_iterator end() const { return const_iterator(); }
+    constexpr const_iterator cbegin() const { return begin(); }
+    constexpr const_iterator cend() const { return end(); }
+
+    constexpr bool operator==(const TileMask& other) const
+    {
+        return m_low == other.m_low && m_high == other.m_high;
+    }
+    constexpr bool operator!=(const TileMask& other) const { return !(*this == other); }
+
+    constexpr TileMask operator|(const TileMask& other) const
+    {
+        return fromWords(m_low | other.m_low, m_high | other.m_high);
+    }
+    constexpr TileMask operator&(const TileMask& other) const
+    {
+        return fromWords(m_low & other.m_low, m_high & other.m_high);
+    }
+    // set difference: tiles of this set that are not in the other one
+    constexpr TileMask operator-(const TileMask& other) const
+    {
+        return fromWords(m_low & ~other.m_low, m_high & ~other.m_high);
+    }
+
+    constexpr TileMask& operator|=(const TileMask& other) { return *this = *this | other; }
+    constexpr TileMask& operator&=(const TileMask& other) { return *this = *this & other; }
+    constexpr TileMask& operator-=(const TileMask& other) { return *this = *this - other; }
+
+  private:
+    WordType m_low{0};
+    WordType m_high{0};
+
+    static constexpr TileMask fromWords(const WordType low, const WordType high)
+    {
+        TileMask result;
+        result.m_low = low;
+        result.m_high = high & HIGH_WORD_MASK;
+        return result;
+    }
+};
+
+#endif // __TILEMASK_H__
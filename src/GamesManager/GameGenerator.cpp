@@ -0,0 +1,185 @@
+#include "GameGenerator.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <numeric>
+#include <thread>
+
+namespace
+{
+// splitmix64, spreads close seeds (seed, seed + 1, ...) over unrelated states of the engine
+std::uint64_t mixSeed(const std::uint64_t seed, const std::uint64_t index)
+{
+    std::uint64_t z = seed + (index + 1) * 0x9e3779b97f4a7c15ull;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31);
+}
+
+int compareDifficulties(const GameDifficulty first, const GameDifficulty second)
+{
+    return static_cast<int>(first) - static_cast<int>(second);
+}
+} // namespace
+
+GameDifficulty getGameDifficultyOfRating(const DifficultyRating& rating)
+{
+    switch (rating.hardestTier)
+    {
+    case TechniqueTier::NONE:
+    case TechniqueTier::BASIC: return GameDifficulty::Simple;
+    case TechniqueTier::EASY: return GameDifficulty::Easy;
+    case TechniqueTier::INTERMEDIATE: return GameDifficulty::Intermediate;
+    case TechniqueTier::ADVANCED: return GameDifficulty::Expert;
+    }
+    return GameDifficulty::Expert;
+}
+
+double GenerationSummary::getPuzzlesPerSecond() const
+{
+    return elapsedSeconds > 0.0 ? static_cast<double>(puzzlesCount) / elapsedSeconds : 0.0;
+}
+
+std::string GenerationSummary::toString() const
+{
+    return fmt::format("{}: {} puzzles in {:.3f}s ({:.1f} puzzles/s), {} grids tried",
+                       difficulty == GameDifficulty::Any ? "Any" : gameDifficultyToString(difficulty),
+                       puzzlesCount,
+                       elapsedSeconds,
+                       getPuzzlesPerSecond(),
+                       attemptsCount);
+}
+
+GameGenerator::GameGenerator(const std::uint64_t seed)
+    : m_rng(seed)
+{}
+
+void GameGenerator::seed(const std::uint64_t seed)
+{
+    m_rng.seed(seed);
+}
+
+GridState GameGenerator::generateSolution()
+{
+    // os subgrids da diagonal não se veem, então podem ser preenchidos livremente. O resto vem da primeira
+    // solução encontrada a partir deles
+    GridState grid;
+    std::array<TileValueType, 9> values;
+    std::iota(values.begin(), values.end(), TileValueType{1});
+    for (const TileValueType subgrid : {0, 4, 8})
+    {
+        std::shuffle(values.begin(), values.end(), m_rng);
+        const auto& tiles = BoardGeometry::getRegionTiles(RegionSpecificType::SUBGRID, subgrid);
+        for (size_t i = 0; i < tiles.size(); ++i) { grid.values[tiles[i]] = values[i]; }
+    }
+    m_solutionCounter.countSolutions(grid);
+    return m_solutionCounter.getSolution();
+}
+
+GridState GameGenerator::removeClues(const GridState& solution,
+                                     std::vector<BoardGeometry::TileIndex>& removedTiles)
+{
+    std::array<BoardGeometry::TileIndex, BoardGeometry::TILES_COUNT> tiles;
+    std::iota(tiles.begin(), tiles.end(), BoardGeometry::TileIndex{0});
+    std::shuffle(tiles.begin(), tiles.end(), m_rng);
+
+    GridState puzzle = solution;
+    removedTiles.clear();
+    for (const auto tileIndex : tiles)
+    {
+        puzzle.values[tileIndex] = 0;
+        if (m_solutionCounter.countSolutions(puzzle) == SolutionsCount::UNIQUE)
+        {
+            removedTiles.push_back(tileIndex);
+        }
+        else
+        {
+            puzzle.values[tileIndex] = solution.values[tileIndex];
+        }
+    }
+    return puzzle;
+}
+
+std::string GameGenerator::generateMinimalPuzzle()
+{
+    std::vector<BoardGeometry::TileIndex> removedTiles;
+    return toValuesString(removeClues(generateSolution(), removedTiles));
+}
+
+GameDifficulty GameGenerator::rate(const GridState& puzzle)
+{
+    return getGameDifficultyOfRating(m_rater.rate(toValuesString(puzzle)));
+}
+
+std::string GameGenerator::generate(const GameDifficulty difficulty)
+{
+    std::vector<BoardGeometry::TileIndex> removedTiles;
+    while (true)
+    {
+        ++m_attemptsCount;
+        const auto solution = generateSolution();
+        auto puzzle = removeClues(solution, removedTiles);
+        if (difficulty == GameDifficulty::Any)
+        {
+            return toValuesString(puzzle);
+        }
+
+        // devolve as dicas na ordem inversa da remoção até chegar na dificuldade pedida (ou passar dela)
+        auto puzzleDifficulty = rate(puzzle);
+        for (auto tile = removedTiles.rbegin();
+             tile != removedTiles.rend() && compareDifficulties(puzzleDifficulty, difficulty) > 0;
+             ++tile)
+        {
+            puzzle.values[*tile] = solution.values[*tile];
+            puzzleDifficulty = rate(puzzle);
+        }
+        if (puzzleDifficulty == difficulty)
+        {
+            return toValuesString(puzzle);
+        }
+    }
+}
+
+std::vector<std::string> GameGenerator::generateInParallel(const GameDifficulty difficulty,
+                                                           const size_t count,
+                                                           const unsigned int threadsCount,
+                                                           const std::uint64_t seed,
+                                                           GenerationSummary* summary)
+{
+    const auto begin = std::chrono::steady_clock::now();
+
+    std::vector<std::string> puzzles(count);
+    std::atomic<size_t> nextPuzzle{0};
+    std::atomic<size_t> attemptsCount{0};
+
+    const auto worker = [&]() {
+        GameGenerator generator;
+        for (size_t index = nextPuzzle++; index < count; index = nextPuzzle++)
+        {
+            generator.seed(mixSeed(seed, index));
+            puzzles[index] = generator.generate(difficulty);
+        }
+        attemptsCount += generator.getAttemptsCount();
+    };
+
+    const auto workersCount =
+        static_cast<unsigned int>(std::clamp<size_t>(count, 1, std::max(threadsCount, 1u)));
+    std::vector<std::thread> workers;
+    workers.reserve(workersCount);
+    for (unsigned int i = 0; i < workersCount; ++i) { workers.emplace_back(worker); }
+    for (auto& thread : workers) { thread.join(); }
+
+    if (summary != nullptr)
+    {
+        summary->difficulty = difficulty;
+        summary->puzzlesCount = count;
+        summary->attemptsCount = attemptsCount;
+        summary->workersCount = workersCount;
+        summary->elapsedSeconds =
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+    }
+    return puzzles;
+}
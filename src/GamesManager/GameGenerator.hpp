@@ -0,0 +1,77 @@
+#ifndef __GAMEGENERATOR_H__
+#define __GAMEGENERATOR_H__
+
+#include "Board/BoardGeometry.hpp"
+#include "Board/GridState.hpp"
+#include "Games.hpp"
+#include "Solver/DifficultyRater.hpp"
+#include "Solver/SolutionCounter.hpp"
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+// the difficulty of a rated puzzle, given by the highest TechniqueTier needed to solve it. Advanced
+// techniques (and the search) are Expert
+GameDifficulty getGameDifficultyOfRating(const DifficultyRating& rating);
+
+struct GenerationSummary
+{
+    GameDifficulty difficulty{GameDifficulty::Any};
+    size_t puzzlesCount{0};
+    // puzzles generated and rated, including the ones discarded for being of another difficulty
+    size_t attemptsCount{0};
+    // threads actually started, never more than the puzzles requested
+    unsigned int workersCount{0};
+    double elapsedSeconds{0.0};
+
+    double getPuzzlesPerSecond() const;
+    std::string toString() const;
+};
+
+// Generates puzzles with a unique solution: a random complete grid has its clues removed in random order
+// while the solution stays unique, and the resulting puzzle is rated with DifficultyRater. When it is
+// harder than requested, removed clues are given back until it lands in the requested difficulty (or gets
+// easier than it, in which case a new grid is tried).
+//
+// All the randomness comes from the generator's own engine, so the same seed always produces the same
+// puzzles.
+class GameGenerator
+{
+  public:
+    explicit GameGenerator(std::uint64_t seed = std::random_device{}());
+
+    void seed(std::uint64_t seed);
+
+    GridState generateSolution();
+    // a puzzle from which no clue can be removed without losing the uniqueness of its solution
+    std::string generateMinimalPuzzle();
+    // Any accepts the first minimal puzzle
+    std::string generate(GameDifficulty difficulty);
+
+    // grids tried by the calls to generate since the generator was created
+    size_t getAttemptsCount() const { return m_attemptsCount; }
+
+    // Generates count puzzles with threadsCount threads, each with its own generator. The puzzle at
+    // position i is generated from a seed made of seed and i, so the result doesn't depend on the number
+    // of threads
+    static std::vector<std::string> generateInParallel(GameDifficulty difficulty,
+                                                       size_t count,
+                                                       unsigned int threadsCount,
+                                                       std::uint64_t seed,
+                                                       GenerationSummary* summary = nullptr);
+
+  private:
+    std::mt19937_64 m_rng;
+    SolutionCounter m_solutionCounter;
+    DifficultyRater m_rater;
+    size_t m_attemptsCount{0};
+
+    // removes the clues of the solution in random order, while its solution stays unique. removedTiles
+    // receives the tiles that were emptied, in the order they were emptied
+    GridState removeClues(const GridState& solution, std::vector<BoardGeometry::TileIndex>& removedTiles);
+    GameDifficulty rate(const GridState& puzzle);
+};
+
+#endif // __GAMEGENERATOR_H__
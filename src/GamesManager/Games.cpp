@@ -1,5 +1,7 @@
 #include "Games.hpp"
 
+#include <algorithm>
+#include <cctype>
 #include <iostream>
 #include <random>
 
@@ -32,6 +34,27 @@ const static std::vector<std::string> expertGames = {
     ".........51..2..733....69.2.7.16.....5...3..7.369........235........4..67...1..3.",
     "..9.....43..6..2......53.........81.16.4.5..223..8...9...21....94..36.........6.."};
 
+const std::vector<std::string>& getGamesOfDifficulty(GameDifficulty difficulty)
+{
+    switch (difficulty)
+    {
+    case GameDifficulty::Simple: return simpleGames;
+    case GameDifficulty::Easy: return easyGames;
+    case GameDifficulty::Intermediate: return intermediateGames;
+    case GameDifficulty::Expert: return expertGames;
+    default:
+        const static std::vector<std::string> allGames = [] {
+            std::vector<std::string> games;
+            for (const auto* gamesOfDifficulty : {&simpleGames, &easyGames, &intermediateGames, &expertGames})
+            {
+                games.insert(games.end(), gamesOfDifficulty->begin(), gamesOfDifficulty->end());
+            }
+            return games;
+        }();
+        return allGames;
+    }
+}
+
 // convert GameDifficulty to string
 std::string gameDifficultyToString(GameDifficulty difficulty)
 {
@@ -45,6 +68,30 @@ std::string gameDifficultyToString(GameDifficulty difficulty)
     }
 }
 
+std::optional<GameDifficulty> gameDifficultyFromString(const std::string& name)
+{
+    const auto toLower = [](std::string text) {
+        std::transform(text.begin(), text.end(), text.begin(), [](const unsigned char c) {
+            return static_cast<char>(std::tolower(c));
+        });
+        return text;
+    };
+    const auto lowerName = toLower(name);
+    if (lowerName == "any")
+    {
+        return GameDifficulty::Any;
+    }
+    for (const auto difficulty :
+         {GameDifficulty::Simple, GameDifficulty::Easy, GameDifficulty::Intermediate, GameDifficulty::Expert})
+    {
+        if (toLower(gameDifficultyToString(difficulty)) == lowerName)
+        {
+            return difficulty;
+        }
+    }
+    return std::nullopt;
+}
+
 const std::string& getGameOfDifficulty(GameDifficulty difficulty)
 {
     std::random_device dev;
@@ -1,7 +1,9 @@
 #ifndef __GAMES_H__
 #define __GAMES_H__
 
+#include <optional>
 #include <string>
+#include <vector>
 
 enum class GameDifficulty
 {
@@ -12,6 +14,12 @@ enum class GameDifficulty
     Expert = 4
 };
 
+std::string gameDifficultyToString(GameDifficulty difficulty);
+// accepts the names returned by gameDifficultyToString and "Any", ignoring the case
+std::optional<GameDifficulty> gameDifficultyFromString(const std::string& name);
+
 const std::string& getGameOfDifficulty(GameDifficulty difficulty);
+// all the games of a difficulty, in a fixed order. Any returns the games of every difficulty
+const std::vector<std::string>& getGamesOfDifficulty(GameDifficulty difficulty);
 
 #endif // __GAMES_H__
\ No newline at end of file
@@ -0,0 +1,347 @@
+#include "BatchSolver.hpp"
+#include "DifficultyRater.hpp"
+#include "DlxSolver.hpp"
+#include "SolutionCounter.hpp"
+#include "Solver.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace
+{
+std::string trimmed(const std::string& line)
+{
+    const auto first = line.find_first_not_of(" \t\r");
+    if (first == std::string::npos)
+    {
+        return {};
+    }
+    const auto last = line.find_last_not_of(" \t\r");
+    return line.substr(first, last - first + 1);
+}
+
+// reads the next puzzle of the input, skipping empty lines and comments
+bool readPuzzle(std::istream& input, std::string& puzzle)
+{
+    for (std::string line; std::getline(input, line);)
+    {
+        puzzle = trimmed(line);
+        if (!puzzle.empty() && puzzle.front() != '#')
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void accountResult(const BatchSolver::PuzzleResult& result, BatchSolverSummary& summary)
+{
+    ++summary.puzzlesCount;
+    switch (result.status)
+    {
+    case BatchSolver::PuzzleStatus::SOLVED: break;
+    case BatchSolver::PuzzleStatus::UNSOLVED: ++summary.unsolvedCount; break;
+    case BatchSolver::PuzzleStatus::INVALID: ++summary.invalidCount; break;
+    case BatchSolver::PuzzleStatus::NO_SOLUTION: ++summary.noSolutionCount; break;
+    case BatchSolver::PuzzleStatus::MULTIPLE_SOLUTIONS: ++summary.multipleSolutionsCount; break;
+    }
+}
+
+void writeResult(const BatchSolver::PuzzleResult& result, std::ostream& output)
+{
+    if (!result.line.empty())
+    {
+        output << result.line << '\n';
+    }
+}
+
+// The solver used by one thread, created once and reused for all of its puzzles
+class PuzzleSolver
+{
+  public:
+    PuzzleSolver(const BatchSolver::Engine engine, const BatchSolver::Mode mode)
+    {
+        if (mode == BatchSolver::Mode::FILTER_UNIQUE)
+        {
+            m_solutionCounter = std::make_unique<SolutionCounter>();
+            return;
+        }
+        if (mode == BatchSolver::Mode::RATE)
+        {
+            m_rater = std::make_unique<DifficultyRater>();
+            return;
+        }
+        switch (engine)
+        {
+        case BatchSolver::Engine::TECHNIQUES: m_solver = std::make_unique<Solver>(); break;
+        case BatchSolver::Engine::DLX: m_dlxSolver = std::make_unique<DlxSolver>(); break;
+        }
+    }
+
+    BatchSolver::PuzzleResult solve(const std::string& puzzle)
+    {
+        if (m_solutionCounter)
+        {
+            return BatchSolver::filterPuzzle(*m_solutionCounter, puzzle);
+        }
+        if (m_rater)
+        {
+            return BatchSolver::ratePuzzle(*m_rater, puzzle);
+        }
+        return m_solver ? BatchSolver::solvePuzzle(*m_solver, puzzle)
+                        : BatchSolver::solvePuzzle(*m_dlxSolver, puzzle);
+    }
+
+  private:
+    std::unique_ptr<SolutionCounter> m_solutionCounter;
+    std::unique_ptr<DifficultyRater> m_rater;
+    std::unique_ptr<Solver> m_solver;
+    std::unique_ptr<DlxSolver> m_dlxSolver;
+};
+
+// Slots of the reorder buffer. The puzzle with sequence number n lives in slot n % size until it is
+// written to the output
+struct ReorderBuffer
+{
+    struct Slot
+    {
+        std::string puzzle;
+        BatchSolver::PuzzleResult result;
+        bool done{false};
+    };
+
+    explicit ReorderBuffer(const size_t size)
+        : slots(size)
+    {}
+
+    std::vector<Slot> slots;
+    size_t readCount{0};    // puzzles placed in the buffer
+    size_t claimedCount{0}; // puzzles taken by a worker
+    size_t writtenCount{0}; // puzzles written to the output
+    bool inputFinished{false};
+
+    std::mutex mutex;
+    std::condition_variable workAvailable;
+    std::condition_variable slotDone;
+
+    Slot& slotFor(const size_t sequence) { return slots[sequence % slots.size()]; }
+};
+} // namespace
+
+double BatchSolverSummary::getPuzzlesPerSecond() const
+{
+    return elapsedSeconds > 0.0 ? static_cast<double>(puzzlesCount) / elapsedSeconds : 0.0;
+}
+
+std::string BatchSolverSummary::toString() const
+{
+    auto result = fmt::format("{} puzzles in {:.3f}s ({:.1f} puzzles/s), unsolved: {}, invalid: {}",
+                              puzzlesCount,
+                              elapsedSeconds,
+                              getPuzzlesPerSecond(),
+                              unsolvedCount,
+                              invalidCount);
+    if (noSolutionCount > 0 || multipleSolutionsCount > 0)
+    {
+        result += fmt::format(
+            ", without solution: {}, with multiple solutions: {}", noSolutionCount, multipleSolutionsCount);
+    }
+    return result;
+}
+
+BatchSolver::BatchSolver(unsigned int threadsCount, size_t reorderBufferSize, Engine engine)
+    : m_threadsCount(std::max(threadsCount, 1u))
+    , m_reorderBufferSize(reorderBufferSize == 0 ? m_threadsCount * 64 : reorderBufferSize)
+    , m_engine(engine)
+{}
+
+BatchSolver::PuzzleResult BatchSolver::solvePuzzle(Solver& solver, const std::string& puzzle)
+{
+    try
+    {
+        solver.loadBoard(puzzle);
+        const bool solved = solver.trySolve();
+        return {solver.getValuesString(), solved ? PuzzleStatus::SOLVED : PuzzleStatus::UNSOLVED};
+    }
+    catch (const std::runtime_error&)
+    {
+        return {puzzle, PuzzleStatus::INVALID};
+    }
+}
+
+BatchSolver::PuzzleResult BatchSolver::solvePuzzle(DlxSolver& solver, const std::string& puzzle)
+{
+    try
+    {
+        solver.loadBoard(puzzle);
+        const bool solved = solver.solve();
+        return {solver.getValuesString(), solved ? PuzzleStatus::SOLVED : PuzzleStatus::UNSOLVED};
+    }
+    catch (const std::runtime_error&)
+    {
+        return {puzzle, PuzzleStatus::INVALID};
+    }
+}
+
+BatchSolver::PuzzleResult BatchSolver::filterPuzzle(SolutionCounter& counter, const std::string& puzzle)
+{
+    SolutionsCount solutionsCount;
+    try
+    {
+        solutionsCount = counter.countSolutions(puzzle);
+    }
+    catch (const std::runtime_error&)
+    {
+        return {{}, PuzzleStatus::INVALID};
+    }
+
+    switch (solutionsCount)
+    {
+    case SolutionsCount::NONE: return {{}, PuzzleStatus::NO_SOLUTION};
+    case SolutionsCount::UNIQUE: return {puzzle, PuzzleStatus::SOLVED};
+    default: return {{}, PuzzleStatus::MULTIPLE_SOLUTIONS};
+    }
+}
+
+BatchSolver::PuzzleResult BatchSolver::ratePuzzle(DifficultyRater& rater, const std::string& puzzle)
+{
+    DifficultyRating rating;
+    try
+    {
+        rating = rater.rate(puzzle);
+    }
+    catch (const std::runtime_error&)
+    {
+        return {{}, PuzzleStatus::INVALID};
+    }
+
+    switch (rating.solutionsCount)
+    {
+    case SolutionsCount::NONE: return {{}, PuzzleStatus::NO_SOLUTION};
+    case SolutionsCount::UNIQUE:
+        return {
+            fmt::format("{} {} {} {}", puzzle, rating.score, rating.hardestTechniqueName, rating.stepsCount),
+            PuzzleStatus::SOLVED};
+    default: return {{}, PuzzleStatus::MULTIPLE_SOLUTIONS};
+    }
+}
+
+BatchSolverSummary BatchSolver::run(std::istream& input, std::ostream& output) const
+{
+    BatchSolverSummary summary;
+    const auto begin = std::chrono::steady_clock::now();
+
+    if (m_threadsCount == 1)
+    {
+        runSingleThreaded(input, output, summary);
+    }
+    else
+    {
+        runMultiThreaded(input, output, summary);
+    }
+    output.flush();
+
+    const auto end = std::chrono::steady_clock::now();
+    summary.elapsedSeconds = std::chrono::duration<double>(end - begin).count();
+    return summary;
+}
+
+void BatchSolver::runSingleThreaded(std::istream& input,
+                                    std::ostream& output,
+                                    BatchSolverSummary& summary) const
+{
+    PuzzleSolver solver(m_engine, m_mode);
+    for (std::string puzzle; readPuzzle(input, puzzle);)
+    {
+        const auto result = solver.solve(puzzle);
+        accountResult(result, summary);
+        writeResult(result, output);
+    }
+}
+
+void BatchSolver::runMultiThreaded(std::istream& input,
+                                   std::ostream& output,
+                                   BatchSolverSummary& summary) const
+{
+    ReorderBuffer buffer(m_reorderBufferSize);
+
+    const auto worker = [&buffer, engine = m_engine, mode = m_mode]() {
+        PuzzleSolver solver(engine, mode);
+        while (true)
+        {
+            size_t sequence;
+            std::string puzzle;
+            {
+                std::unique_lock lock(buffer.mutex);
+                buffer.workAvailable.wait(
+                    lock, [&] { return buffer.claimedCount < buffer.readCount || buffer.inputFinished; });
+                if (buffer.claimedCount == buffer.readCount)
+                {
+                    return;
+                }
+                sequence = buffer.claimedCount++;
+                puzzle = std::move(buffer.slotFor(sequence).puzzle);
+            }
+
+            auto result = solver.solve(puzzle);
+
+            {
+                std::lock_guard lock(buffer.mutex);
+                auto& slot = buffer.slotFor(sequence);
+                slot.result = std::move(result);
+                slot.done = true;
+            }
+            buffer.slotDone.notify_one();
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(m_threadsCount);
+    for (unsigned int i = 0; i < m_threadsCount; ++i) { workers.emplace_back(worker); }
+
+    // writes, in order, the results that are already done. Must be called with the lock held
+    const auto flushDone = [&]() {
+        while (buffer.writtenCount < buffer.readCount && buffer.slotFor(buffer.writtenCount).done)
+        {
+            auto& slot = buffer.slotFor(buffer.writtenCount);
+            accountResult(slot.result, summary);
+            writeResult(slot.result, output);
+            slot.done = false;
+            ++buffer.writtenCount;
+        }
+    };
+
+    for (std::string puzzle; readPuzzle(input, puzzle);)
+    {
+        std::unique_lock lock(buffer.mutex);
+        // waits for the oldest puzzle to be written before reusing its slot
+        buffer.slotDone.wait(lock, [&] {
+            flushDone();
+            return buffer.readCount - buffer.writtenCount < buffer.slots.size();
+        });
+        buffer.slotFor(buffer.readCount).puzzle = std::move(puzzle);
+        ++buffer.readCount;
+        lock.unlock();
+        buffer.workAvailable.notify_one();
+    }
+
+    {
+        std::unique_lock lock(buffer.mutex);
+        buffer.inputFinished = true;
+        buffer.workAvailable.notify_all();
+        buffer.slotDone.wait(lock, [&] {
+            flushDone();
+            return buffer.writtenCount == buffer.readCount;
+        });
+    }
+
+    for (auto& thread : workers) { thread.join(); }
+}
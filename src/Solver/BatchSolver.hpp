@@ -0,0 +1,102 @@
+#ifndef __BATCHSOLVER_H__
+#define __BATCHSOLVER_H__
+
+#include <cstddef>
+#include <istream>
+#include <ostream>
+#include <string>
+
+class DifficultyRater;
+class DlxSolver;
+class Solver;
+class SolutionCounter;
+
+struct BatchSolverSummary
+{
+    size_t puzzlesCount{0};
+    size_t unsolvedCount{0};
+    size_t invalidCount{0};
+    size_t noSolutionCount{0};
+    size_t multipleSolutionsCount{0};
+    double elapsedSeconds{0.0};
+
+    double getPuzzlesPerSecond() const;
+    std::string toString() const;
+};
+
+// Solves a stream of puzzles, one per line, in the format accepted by Solver(const std::string&). For
+// every puzzle one line is written to the output: the 81 values of the board after solving ('.' for the
+// tiles that could not be solved), or the puzzle itself if it could not be parsed. Empty lines and lines
+// starting with '#' are ignored.
+//
+// In the FILTER_UNIQUE mode the puzzles are not solved: only the ones with exactly one solution are
+// written, unchanged, and the others are just counted in the summary.
+//
+// In the RATE mode the puzzles with exactly one solution are written followed by their difficulty score,
+// the hardest technique needed and the number of steps, separated by spaces (see DifficultyRater). The
+// others are counted like in the FILTER_UNIQUE mode.
+//
+// With more than one thread, each worker reuses a single solver for all of its puzzles and the results
+// go through a reorder buffer of bounded size, so the output keeps the order of the input.
+class BatchSolver
+{
+  public:
+    enum class Engine
+    {
+        // the human techniques of Solver, with the search fallback
+        TECHNIQUES,
+        // the exact cover solver of DlxSolver
+        DLX
+    };
+
+    enum class Mode
+    {
+        SOLVE,
+        FILTER_UNIQUE,
+        RATE
+    };
+
+    enum class PuzzleStatus
+    {
+        SOLVED,
+        UNSOLVED,
+        INVALID,
+        NO_SOLUTION,
+        MULTIPLE_SOLUTIONS
+    };
+
+    struct PuzzleResult
+    {
+        // empty when nothing should be written for the puzzle
+        std::string line;
+        PuzzleStatus status{PuzzleStatus::INVALID};
+    };
+
+    explicit BatchSolver(unsigned int threadsCount = 1,
+                         size_t reorderBufferSize = 0,
+                         Engine engine = Engine::TECHNIQUES);
+
+    BatchSolverSummary run(std::istream& input, std::ostream& output) const;
+
+    static PuzzleResult solvePuzzle(Solver& solver, const std::string& puzzle);
+    static PuzzleResult solvePuzzle(DlxSolver& solver, const std::string& puzzle);
+    static PuzzleResult filterPuzzle(SolutionCounter& counter, const std::string& puzzle);
+    static PuzzleResult ratePuzzle(DifficultyRater& rater, const std::string& puzzle);
+
+    unsigned int getThreadsCount() const { return m_threadsCount; }
+    size_t getReorderBufferSize() const { return m_reorderBufferSize; }
+    Engine getEngine() const { return m_engine; }
+    void setMode(Mode mode) { m_mode = mode; }
+    Mode getMode() const { return m_mode; }
+
+  private:
+    unsigned int m_threadsCount;
+    size_t m_reorderBufferSize;
+    Engine m_engine;
+    Mode m_mode{Mode::SOLVE};
+
+    void runSingleThreaded(std::istream& input, std::ostream& output, BatchSolverSummary& summary) const;
+    void runMultiThreaded(std::istream& input, std::ostream& output, BatchSolverSummary& summary) const;
+};
+
+#endif // __BATCHSOLVER_H__
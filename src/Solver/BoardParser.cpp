@@ -0,0 +1,68 @@
+#include "BoardParser.hpp"
+
+#include <fmt/format.h>
+
+#include <stdexcept>
+
+ParsedBoard parseBoard(const std::string& fromBoard)
+{
+    ParsedBoard result;
+
+    size_t currentIndex = 0;
+    size_t currentTileIndex = 0;
+    while (currentIndex < fromBoard.size())
+    {
+        if (currentTileIndex >= BoardGeometry::TILES_COUNT)
+        {
+            throw std::runtime_error(
+                fmt::format("Board has more than {} tiles", BoardGeometry::TILES_COUNT));
+        }
+        auto& currentTile = result.tiles[currentTileIndex];
+        ++currentTileIndex;
+        const auto& currentToken = fromBoard[currentIndex];
+        switch (currentToken)
+        {
+        case '{':
+        {
+            result.hasSuggestions = true;
+            currentTile.hasSuggestions = true;
+            const auto endingSuggestionIndex = fromBoard.find('}', currentIndex);
+            if (endingSuggestionIndex == std::string::npos)
+            {
+                throw std::runtime_error(
+                    fmt::format("Missing closing bracket for suggestion at tile index {}", currentTileIndex));
+            }
+            const auto suggestionsString =
+                fromBoard.substr(currentIndex + 1, endingSuggestionIndex - currentIndex - 1);
+            for (const auto& suggestion : suggestionsString)
+            {
+                const auto value = static_cast<TileValueType>(suggestion - '0');
+                if (value < 1 || value > 9)
+                {
+                    throw std::runtime_error(
+                        fmt::format("Invalid suggestion value {} at tile index {}", value, currentTileIndex));
+                }
+                currentTile.suggestions.insert(value);
+            }
+            currentIndex = endingSuggestionIndex + 1;
+            break;
+        }
+        default:
+        {
+            ++currentIndex;
+            if (currentToken == '.' || currentToken == '0')
+            {
+                break;
+            }
+            const auto value = static_cast<TileValueType>(currentToken - '0');
+            if (value < 0 || value > 9)
+            {
+                throw std::runtime_error(
+                    fmt::format("Invalid tile value {} at tile index {}", value, currentTileIndex));
+            }
+            currentTile.value = value;
+        }
+        }
+    }
+    return result;
+}
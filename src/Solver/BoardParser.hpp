@@ -0,0 +1,30 @@
+#ifndef __BOARDPARSER_H__
+#define __BOARDPARSER_H__
+
+#include "Board/BoardGeometry.hpp"
+#include "Suggestions.hpp"
+#include "Util/GlobalDefinitions.hpp"
+
+#include <array>
+#include <string>
+
+// Content of a board string: one token per tile, in row-major order. A token is a value ('1'-'9'), an
+// empty tile ('.' or '0') or a group of suggestions between brackets ("{139}"). Boards with less than 81
+// tokens leave the remaining tiles empty.
+struct ParsedTile
+{
+    TileValueType value{0};
+    Suggestions suggestions;
+    bool hasSuggestions{false};
+};
+
+struct ParsedBoard
+{
+    std::array<ParsedTile, BoardGeometry::TILES_COUNT> tiles{};
+    bool hasSuggestions{false};
+};
+
+// throws std::runtime_error if the string is not a valid board
+ParsedBoard parseBoard(const std::string& fromBoard);
+
+#endif // __BOARDPARSER_H__
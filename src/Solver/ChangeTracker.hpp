@@ -0,0 +1,69 @@
+#ifndef __CHANGETRACKER_H__
+#define __CHANGETRACKER_H__
+
+#include "Board/BoardGeometry.hpp"
+#include "Board/TileMask.hpp"
+
+#include <array>
+#include <cstdint>
+
+// Remembers when each tile and region of a Solver last changed (a value set, a suggestion added or
+// removed), so the techniques can scan only what changed since their last run. Changes are stamped with
+// the current epoch, which is advanced by the readers: a change is newer than a stamp returned by
+// advance() if it happened after that call.
+class ChangeTracker
+{
+  public:
+    using Stamp = std::uint64_t;
+
+    void markTileChanged(const BoardGeometry::TileIndex tileIndex)
+    {
+        m_tileStamps[tileIndex] = m_stamp;
+        for (const auto regionIndex : BoardGeometry::TILE_REGIONS[tileIndex])
+        {
+            m_regionStamps[regionIndex] = m_stamp;
+        }
+    }
+
+    void markAllChanged()
+    {
+        m_tileStamps.fill(m_stamp);
+        m_regionStamps.fill(m_stamp);
+    }
+
+    Stamp advance() { return m_stamp++; }
+
+    TileMask getChangedTilesSince(const Stamp stamp) const
+    {
+        TileMask changedTiles;
+        for (BoardGeometry::TileIndex tileIndex = 0; tileIndex < BoardGeometry::TILES_COUNT; ++tileIndex)
+        {
+            if (m_tileStamps[tileIndex] > stamp)
+            {
+                changedTiles.insert(tileIndex);
+            }
+        }
+        return changedTiles;
+    }
+
+    BoardGeometry::RegionMask getChangedRegionsSince(const Stamp stamp) const
+    {
+        BoardGeometry::RegionMask changedRegions = 0;
+        for (BoardGeometry::RegionIndex regionIndex = 0; regionIndex < BoardGeometry::REGIONS_COUNT;
+             ++regionIndex)
+        {
+            if (m_regionStamps[regionIndex] > stamp)
+            {
+                changedRegions |= BoardGeometry::RegionMask{1} << regionIndex;
+            }
+        }
+        return changedRegions;
+    }
+
+  private:
+    Stamp m_stamp{1};
+    std::array<Stamp, BoardGeometry::TILES_COUNT> m_tileStamps{};
+    std::array<Stamp, BoardGeometry::REGIONS_COUNT> m_regionStamps{};
+};
+
+#endif // __CHANGETRACKER_H__
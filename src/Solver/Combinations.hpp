@@ -0,0 +1,95 @@
+#ifndef __COMBINATIONS_H__
+#define __COMBINATIONS_H__
+
+#include <bit>
+#include <cstdint>
+#include <iterator>
+
+// The k-combinations of the elements 0..n-1, enumerated lazily as bitmasks: bit i is set when the element i
+// is part of the combination. Each step is Gosper's hack (the next larger mask with the same number of set
+// bits), so the combinations come in colexicographic order and nothing is allocated. Meant for the small
+// sets of the board (the tiles or values of a region), so n is limited to MAX_ELEMENTS.
+class Combinations
+{
+  public:
+    using MaskType = std::uint32_t;
+
+    static constexpr unsigned int MAX_ELEMENTS = 16;
+
+    struct const_iterator
+    {
+        using iterator_category = std::forward_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+        using value_type = MaskType;
+        using pointer = const MaskType*;
+        using reference = MaskType;
+
+        constexpr const_iterator() = default;
+        constexpr const_iterator(MaskType combination, MaskType limit)
+            : m_combination(combination)
+            , m_limit(limit)
+        {}
+
+        constexpr reference operator*() const { return m_combination; }
+
+        constexpr const_iterator& operator++()
+        {
+            const MaskType lowest = m_combination & (~m_combination + 1);
+            const MaskType ripple = m_combination + lowest;
+            const MaskType next = (((ripple ^ m_combination) >> 2) / lowest) | ripple;
+            // a combination with an element beyond n-1 means all of them were visited
+            m_combination = next < m_limit ? next : 0;
+            return *this;
+        }
+
+        constexpr const_iterator operator++(int)
+        {
+            const_iterator tmp = *this;
+            ++(*this);
+            return tmp;
+        }
+
+        constexpr bool operator==(const const_iterator& other) const
+        {
+            return m_combination == other.m_combination;
+        }
+        constexpr bool operator!=(const const_iterator& other) const { return !(*this == other); }
+
+      private:
+        // 0 is never a combination (k > 0), so it marks the end
+        MaskType m_combination{0};
+        MaskType m_limit{0};
+    };
+
+    // no combination is generated when k is 0 or greater than n
+    constexpr Combinations(unsigned int n, unsigned int k)
+        : m_n(n)
+        , m_k(k)
+    {}
+
+    constexpr const_iterator begin() const
+    {
+        if (m_k == 0 || m_k > m_n)
+        {
+            return end();
+        }
+        return {(MaskType{1} << m_k) - 1, MaskType{1} << m_n};
+    }
+    constexpr const_iterator end() const { return {0, MaskType{1} << m_n}; }
+
+    // calls function(i) for each element i of the combination, in ascending order
+    template<typename Function>
+    static constexpr void forEachElement(MaskType combination, Function&& function)
+    {
+        for (; combination != 0; combination &= combination - 1)
+        {
+            function(static_cast<unsigned int>(std::countr_zero(combination)));
+        }
+    }
+
+  private:
+    unsigned int m_n;
+    unsigned int m_k;
+};
+
+#endif // __COMBINATIONS_H__
@@ -0,0 +1,57 @@
+#include "DifficultyRater.hpp"
+#include "Solver.hpp"
+
+#include <algorithm>
+
+DifficultyRater::DifficultyRater()
+    : m_solver(std::make_unique<Solver>())
+{
+    m_solver->setSearchFallbackEnabled(false);
+}
+
+DifficultyRater::~DifficultyRater() = default;
+
+DifficultyRating DifficultyRater::rate(const std::string& puzzle)
+{
+    DifficultyRating rating;
+    m_solver->loadBoard(puzzle);
+    rating.solvedByTechniques = m_solver->trySolve();
+    // contadas pelo trySolve, a não ser que a checagem tenha sido desabilitada
+    const auto& solutionsCount = m_solver->getSolutionsCount();
+    rating.solutionsCount = solutionsCount ? *solutionsCount : m_solver->countSolutions();
+    if (rating.solutionsCount == SolutionsCount::NONE)
+    {
+        return rating;
+    }
+
+    rating.techniquesReport = m_solver->getTechniquesReport();
+    const auto& techniques = rating.techniquesReport.techniques;
+
+    size_t weightedStepsCount = 0;
+    for (unsigned int i = 0; i < techniques.size(); ++i)
+    {
+        const auto ranCount = techniques[i].ranCount;
+        if (ranCount == 0)
+        {
+            continue;
+        }
+        const auto level = i + 1;
+        rating.hardestLevel = level;
+        rating.hardestTechniqueName = techniques[i].techniqueName;
+        rating.hardestTier = std::max(rating.hardestTier, techniques[i].tier);
+        rating.stepsCount += ranCount;
+        weightedStepsCount += static_cast<size_t>(level) * ranCount;
+    }
+    if (!rating.solvedByTechniques)
+    {
+        rating.hardestLevel = static_cast<unsigned int>(techniques.size()) + 1;
+        rating.hardestTechniqueName = SEARCH_NAME;
+        rating.hardestTier = TechniqueTier::ADVANCED;
+    }
+
+    // os passos desempatam boards com a mesma técnica mais difícil, sem passar para o próximo nível
+    const auto stepsScore = std::min<size_t>(weightedStepsCount, DifficultyRating::SCORE_PER_LEVEL - 1);
+    rating.score =
+        rating.hardestLevel * DifficultyRating::SCORE_PER_LEVEL + static_cast<unsigned int>(stepsScore);
+    return rating;
+}
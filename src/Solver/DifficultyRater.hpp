@@ -0,0 +1,53 @@
+#ifndef __DIFFICULTYRATER_H__
+#define __DIFFICULTYRATER_H__
+
+#include "SolutionCounter.hpp"
+#include "TechniqueStatistics.hpp"
+
+#include <memory>
+#include <string>
+
+class Solver;
+
+struct DifficultyRating
+{
+    static constexpr unsigned int SCORE_PER_LEVEL = 1000;
+
+    SolutionsCount solutionsCount{SolutionsCount::NONE};
+    // false when the techniques stalled and the search would be needed to finish the board
+    bool solvedByTechniques{false};
+    // 1 for the first technique tried by the Solver, increasing in the order they are tried (which is the
+    // order of complexity). One more than the last technique when the search is needed. 0 if the board
+    // had nothing to solve
+    unsigned int hardestLevel{0};
+    std::string hardestTechniqueName;
+    // highest tier among the techniques used, ADVANCED when the search is needed
+    TechniqueTier hardestTier{TechniqueTier::NONE};
+    // changes made to the board by all the techniques
+    size_t stepsCount{0};
+    // SCORE_PER_LEVEL * hardestLevel plus the steps of each technique weighted by its level, capped so the
+    // hardest technique always dominates
+    unsigned int score{0};
+    // what each technique did while rating
+    TechniquesReport techniquesReport;
+};
+
+// Rates puzzles by solving them headless with the techniques of Solver, without the search fallback. The
+// same Solver is reused for every puzzle, so a rater should be kept and reused (one per thread).
+class DifficultyRater
+{
+  public:
+    static constexpr const char* SEARCH_NAME = "Search";
+
+    DifficultyRater();
+    ~DifficultyRater();
+
+    // accepts the same format as Solver(const std::string&). Throws std::runtime_error for invalid boards.
+    // Boards without solution are not solved, and get a rating with only the solutionsCount set
+    DifficultyRating rate(const std::string& puzzle);
+
+  private:
+    std::unique_ptr<Solver> m_solver;
+};
+
+#endif // __DIFFICULTYRATER_H__
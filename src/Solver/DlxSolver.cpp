@@ -0,0 +1,215 @@
+#include "DlxSolver.hpp"
+#include "BoardParser.hpp"
+
+#include "Board/Grid.hpp"
+
+namespace
+{
+constexpr size_t NODES_COUNT = 1 + DlxSolver::CONSTRAINTS_COUNT + 4 * DlxSolver::CANDIDATES_COUNT;
+
+// columns of the four constraints satisfied by a candidate. The header of column i is the node i + 1
+std::array<size_t, 4> getConstraintColumns(const BoardGeometry::TileIndex tileIndex,
+                                           const TileValueType value)
+{
+    const auto digit = static_cast<size_t>(value - 1);
+    const size_t tilesCount = BoardGeometry::TILES_COUNT;
+    return {
+        1 + static_cast<size_t>(tileIndex),
+        1 + tilesCount + BoardGeometry::getRow(tileIndex) * 9 + digit,
+        1 + 2 * tilesCount + BoardGeometry::getCol(tileIndex) * 9 + digit,
+        1 + 3 * tilesCount + BoardGeometry::getSubgrid(tileIndex) * 9 + digit,
+    };
+}
+} // namespace
+
+DlxSolver::DlxSolver()
+{
+    m_nodes.reserve(NODES_COUNT);
+    resetColumns();
+}
+
+void DlxSolver::resetColumns()
+{
+    m_nodes.resize(1 + CONSTRAINTS_COUNT);
+    for (NodeIndex i = 0; i <= CONSTRAINTS_COUNT; ++i)
+    {
+        m_nodes[i] = Node{static_cast<NodeIndex>(i == 0 ? CONSTRAINTS_COUNT : i - 1),
+                          static_cast<NodeIndex>(i == CONSTRAINTS_COUNT ? 0 : i + 1),
+                          i,
+                          i,
+                          i,
+                          0};
+    }
+    m_columnSizes.fill(0);
+}
+
+void DlxSolver::addCandidate(const BoardGeometry::TileIndex tileIndex, const TileValueType value)
+{
+    const auto firstNode = static_cast<NodeIndex>(m_nodes.size());
+    const auto candidate = static_cast<NodeIndex>(tileIndex * 9 + value - 1);
+    const auto columns = getConstraintColumns(tileIndex, value);
+    for (size_t i = 0; i < columns.size(); ++i)
+    {
+        const auto column = static_cast<NodeIndex>(columns[i]);
+        const auto node = static_cast<NodeIndex>(firstNode + i);
+        // insere no fim da coluna e da linha circulares
+        m_nodes.push_back(Node{static_cast<NodeIndex>(i == 0 ? firstNode + 3 : node - 1),
+                               static_cast<NodeIndex>(i == 3 ? firstNode : node + 1),
+                               m_nodes[column].up,
+                               column,
+                               column,
+                               candidate});
+        m_nodes[m_nodes[column].up].down = node;
+        m_nodes[column].up = node;
+        ++m_columnSizes[column];
+    }
+}
+
+void DlxSolver::loadBoard(const std::string& fromBoard)
+{
+    const auto parsedBoard = parseBoard(fromBoard);
+
+    resetColumns();
+    m_givenState = GridState{};
+    for (BoardGeometry::TileIndex tileIndex = 0; tileIndex < BoardGeometry::TILES_COUNT; ++tileIndex)
+    {
+        const auto& parsedTile = parsedBoard.tiles[tileIndex];
+        if (parsedTile.value != 0)
+        {
+            m_givenState.values[tileIndex] = parsedTile.value;
+            addCandidate(tileIndex, parsedTile.value);
+            continue;
+        }
+        const auto candidates = parsedTile.hasSuggestions ? parsedTile.suggestions : Suggestions::allValues();
+        for (const auto value : candidates) { addCandidate(tileIndex, value); }
+    }
+    m_gridState = m_givenState;
+}
+
+void DlxSolver::cover(const NodeIndex column)
+{
+    m_nodes[m_nodes[column].right].left = m_nodes[column].left;
+    m_nodes[m_nodes[column].left].right = m_nodes[column].right;
+    for (auto row = m_nodes[column].down; row != column; row = m_nodes[row].down)
+    {
+        for (auto node = m_nodes[row].right; node != row; node = m_nodes[node].right)
+        {
+            m_nodes[m_nodes[node].down].up = m_nodes[node].up;
+            m_nodes[m_nodes[node].up].down = m_nodes[node].down;
+            --m_columnSizes[m_nodes[node].column];
+        }
+    }
+}
+
+void DlxSolver::uncover(const NodeIndex column)
+{
+    for (auto row = m_nodes[column].up; row != column; row = m_nodes[row].up)
+    {
+        for (auto node = m_nodes[row].left; node != row; node = m_nodes[node].left)
+        {
+            ++m_columnSizes[m_nodes[node].column];
+            m_nodes[m_nodes[node].down].up = node;
+            m_nodes[m_nodes[node].up].down = node;
+        }
+    }
+    m_nodes[m_nodes[column].right].left = column;
+    m_nodes[m_nodes[column].left].right = column;
+}
+
+DlxSolver::NodeIndex DlxSolver::chooseColumn() const
+{
+    // coluna com menos candidatos; uma coluna vazia já encerra o ramo
+    NodeIndex result = m_nodes[ROOT].right;
+    for (auto column = m_nodes[ROOT].right; column != ROOT; column = m_nodes[column].right)
+    {
+        if (m_columnSizes[column] < m_columnSizes[result])
+        {
+            result = column;
+            if (m_columnSizes[result] <= 1)
+            {
+                break;
+            }
+        }
+    }
+    return result;
+}
+
+void DlxSolver::storeSolution()
+{
+    for (size_t i = 0; i < m_selectedCount; ++i)
+    {
+        const auto candidate = m_nodes[m_selectedCandidates[i]].candidate;
+        m_gridState.values[candidate / 9] = static_cast<TileValueType>(candidate % 9 + 1);
+    }
+}
+
+void DlxSolver::search()
+{
+    ++m_searchNodesCount;
+    if (m_nodes[ROOT].right == ROOT)
+    {
+        if (m_solutionsCount == 0)
+        {
+            storeSolution();
+        }
+        ++m_solutionsCount;
+        return;
+    }
+
+    const auto column = chooseColumn();
+    if (m_columnSizes[column] == 0)
+    {
+        return;
+    }
+
+    cover(column);
+    for (auto row = m_nodes[column].down; row != column && m_solutionsCount < m_solutionsLimit;
+         row = m_nodes[row].down)
+    {
+        m_selectedCandidates[m_selectedCount++] = row;
+        for (auto node = m_nodes[row].right; node != row; node = m_nodes[node].right)
+        {
+            cover(m_nodes[node].column);
+        }
+
+        search();
+
+        for (auto node = m_nodes[row].left; node != row; node = m_nodes[node].left)
+        {
+            uncover(m_nodes[node].column);
+        }
+        --m_selectedCount;
+    }
+    uncover(column);
+}
+
+size_t DlxSolver::countSolutions(const size_t limit)
+{
+    m_gridState = m_givenState;
+    m_selectedCount = 0;
+    m_solutionsCount = 0;
+    m_solutionsLimit = limit;
+    m_searchNodesCount = 0;
+    if (limit > 0)
+    {
+        search();
+    }
+    return m_solutionsCount;
+}
+
+bool DlxSolver::solve()
+{
+    return countSolutions(1) == 1;
+}
+
+std::string DlxSolver::getValuesString() const
+{
+    return toValuesString(m_gridState);
+}
+
+std::string DlxSolver::getBoardString() const
+{
+    Grid grid;
+    grid.setGridState(m_gridState);
+    return grid.getBoardString();
+}
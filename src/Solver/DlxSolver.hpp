@@ -0,0 +1,78 @@
+#ifndef __DLXSOLVER_H__
+#define __DLXSOLVER_H__
+
+#include "Board/BoardGeometry.hpp"
+#include "Board/GridState.hpp"
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Brute force solver based on Knuth's Dancing Links (Algorithm X). The board is modeled as an exact cover
+// problem with 324 constraints (each tile has a value, and each value appears once in each row, column and
+// subgrid) and one row per candidate (tile, value). All nodes live in a single arena that is allocated
+// once, so the same DlxSolver can be reused for many boards without allocating.
+class DlxSolver
+{
+  public:
+    static constexpr size_t CONSTRAINTS_COUNT = 4 * BoardGeometry::TILES_COUNT;
+    static constexpr size_t CANDIDATES_COUNT = 9 * BoardGeometry::TILES_COUNT;
+
+    DlxSolver();
+
+    // accepts the same format as Solver(const std::string&). Throws std::runtime_error for invalid boards
+    void loadBoard(const std::string& fromBoard);
+
+    // finds the first solution of the loaded board. Returns false if there is none
+    bool solve();
+    // counts the solutions of the loaded board, stopping as soon as limit is reached. The first solution
+    // found is kept as the solved state
+    size_t countSolutions(size_t limit);
+
+    // the loaded board, or its solution after a successful solve
+    const GridState& getGridState() const { return m_gridState; }
+    std::string getValuesString() const;
+    std::string getBoardString() const;
+
+    size_t getSearchNodesCount() const { return m_searchNodesCount; }
+
+  private:
+    using NodeIndex = std::uint16_t;
+
+    struct Node
+    {
+        NodeIndex left;
+        NodeIndex right;
+        NodeIndex up;
+        NodeIndex down;
+        NodeIndex column;
+        // (tile index * 9 + value - 1) of the candidate represented by the node
+        NodeIndex candidate;
+    };
+
+    static constexpr NodeIndex ROOT = 0;
+
+    std::vector<Node> m_nodes;
+    std::array<NodeIndex, CONSTRAINTS_COUNT + 1> m_columnSizes{};
+
+    GridState m_gridState;
+    GridState m_givenState;
+
+    std::array<NodeIndex, BoardGeometry::TILES_COUNT> m_selectedCandidates{};
+    size_t m_selectedCount{0};
+    size_t m_solutionsCount{0};
+    size_t m_solutionsLimit{1};
+    size_t m_searchNodesCount{0};
+
+    void resetColumns();
+    void addCandidate(BoardGeometry::TileIndex tileIndex, TileValueType value);
+
+    void cover(NodeIndex column);
+    void uncover(NodeIndex column);
+    NodeIndex chooseColumn() const;
+    void search();
+    void storeSolution();
+};
+
+#endif // __DLXSOLVER_H__
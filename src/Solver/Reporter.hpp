@@ -12,6 +12,7 @@
 
 #include <fmt/compile.h>
 #include <fmt/format.h>
+#include <functional>
 #include <string>
 
 auto ss = FMT_COMPILE("{}");
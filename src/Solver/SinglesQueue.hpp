@@ -0,0 +1,90 @@
+#ifndef __SINGLESQUEUE_H__
+#define __SINGLESQUEUE_H__
+
+#include "Board/BoardGeometry.hpp"
+#include "Board/GridState.hpp"
+#include "Board/TileMask.hpp"
+#include "SolverState.hpp"
+#include "Suggestions.hpp"
+
+#include <array>
+#include <bit>
+#include <utility>
+
+// Naked singles (empty tiles left with one suggestion) and hidden singles (values left with one
+// suggestion in a region), queued by the SolverTiles as the suggestions are removed, so SinglesTile and
+// SinglesRegion don't need to scan the board. An entry may be stale when it is taken (the tile may have
+// received a value in the meantime), so it must be checked again. When the state of the Solver is
+// replaced at once, the queue is refilled from the new state.
+class SinglesQueue
+{
+  public:
+    void pushNakedSingle(const BoardGeometry::TileIndex tileIndex) { m_nakedSingles.insert(tileIndex); }
+    void pushHiddenSingle(const BoardGeometry::RegionIndex regionIndex, const TileValueType value)
+    {
+        m_hiddenSingles[regionIndex].insert(value);
+        m_regionsWithHiddenSingles |= BoardGeometry::RegionMask{1} << regionIndex;
+    }
+
+    bool hasNakedSingles() const { return !m_nakedSingles.empty(); }
+    bool hasHiddenSingles() const { return m_regionsWithHiddenSingles != 0; }
+
+    // must only be called when hasNakedSingles()
+    BoardGeometry::TileIndex popNakedSingle()
+    {
+        const auto tileIndex = *m_nakedSingles.begin();
+        m_nakedSingles.erase(tileIndex);
+        return tileIndex;
+    }
+
+    // must only be called when hasHiddenSingles()
+    std::pair<BoardGeometry::RegionIndex, TileValueType> popHiddenSingle()
+    {
+        const auto regionIndex =
+            static_cast<BoardGeometry::RegionIndex>(std::countr_zero(m_regionsWithHiddenSingles));
+        auto& values = m_hiddenSingles[regionIndex];
+        const auto value = values.front();
+        values.erase(value);
+        if (values.empty())
+        {
+            m_regionsWithHiddenSingles &= ~(BoardGeometry::RegionMask{1} << regionIndex);
+        }
+        return {regionIndex, value};
+    }
+
+    void requestRefill() { m_needsRefill = true; }
+    bool needsRefill() const { return m_needsRefill; }
+
+    // queues every single of the state
+    void refill(const GridState& gridState, const SuggestionsState& suggestionsState)
+    {
+        m_nakedSingles = TileMask();
+        for (BoardGeometry::TileIndex tileIndex = 0; tileIndex < BoardGeometry::TILES_COUNT; ++tileIndex)
+        {
+            if (gridState.values[tileIndex] == 0 && suggestionsState.tilesSuggestions[tileIndex].size() == 1)
+            {
+                m_nakedSingles.insert(tileIndex);
+            }
+        }
+        m_regionsWithHiddenSingles = 0;
+        for (BoardGeometry::RegionIndex regionIndex = 0; regionIndex < BoardGeometry::REGIONS_COUNT;
+             ++regionIndex)
+        {
+            m_hiddenSingles[regionIndex] =
+                suggestionsState.regionsSuggestionsQuan[regionIndex].getSuggestionsWithQuantityEqualTo(1);
+            if (!m_hiddenSingles[regionIndex].empty())
+            {
+                m_regionsWithHiddenSingles |= BoardGeometry::RegionMask{1} << regionIndex;
+            }
+        }
+        m_needsRefill = false;
+    }
+
+  private:
+    TileMask m_nakedSingles;
+    std::array<Suggestions, BoardGeometry::REGIONS_COUNT> m_hiddenSingles{};
+    BoardGeometry::RegionMask m_regionsWithHiddenSingles{0};
+    bool m_needsRefill{true};
+};
+
+#endif // __SINGLESQUEUE_H__
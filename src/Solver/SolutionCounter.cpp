@@ -0,0 +1,161 @@
+#include "SolutionCounter.hpp"
+#include "BoardParser.hpp"
+
+#include <bit>
+#include <utility>
+
+std::string solutionsCountToString(const SolutionsCount solutionsCount)
+{
+    switch (solutionsCount)
+    {
+    case SolutionsCount::NONE: return "0";
+    case SolutionsCount::UNIQUE: return "1";
+    case SolutionsCount::MULTIPLE: return "2+";
+    default: return "Unknown";
+    }
+}
+
+SolutionCounter::Mask SolutionCounter::getUsedValues(const BoardGeometry::TileIndex tileIndex) const
+{
+    return static_cast<Mask>(m_rowsUsed[BoardGeometry::getRow(tileIndex)] |
+                             m_colsUsed[BoardGeometry::getCol(tileIndex)] |
+                             m_subgridsUsed[BoardGeometry::getSubgrid(tileIndex)]);
+}
+
+SolutionCounter::Mask SolutionCounter::getOptions(const BoardGeometry::TileIndex tileIndex) const
+{
+    return static_cast<Mask>(m_allowedValues[tileIndex].getMask() & ~getUsedValues(tileIndex));
+}
+
+void SolutionCounter::place(const BoardGeometry::TileIndex tileIndex, const TileValueType value)
+{
+    const auto mask = Suggestions::maskFor(value);
+    m_values[tileIndex] = value;
+    m_rowsUsed[BoardGeometry::getRow(tileIndex)] |= mask;
+    m_colsUsed[BoardGeometry::getCol(tileIndex)] |= mask;
+    m_subgridsUsed[BoardGeometry::getSubgrid(tileIndex)] |= mask;
+}
+
+void SolutionCounter::unplace(const BoardGeometry::TileIndex tileIndex, const TileValueType value)
+{
+    const auto mask = static_cast<Mask>(~Suggestions::maskFor(value));
+    m_values[tileIndex] = 0;
+    m_rowsUsed[BoardGeometry::getRow(tileIndex)] &= mask;
+    m_colsUsed[BoardGeometry::getCol(tileIndex)] &= mask;
+    m_subgridsUsed[BoardGeometry::getSubgrid(tileIndex)] &= mask;
+}
+
+void SolutionCounter::search()
+{
+    if (m_emptyTilesCount == 0)
+    {
+        if (m_solutionsFound == 0)
+        {
+            m_solution.values = m_values;
+        }
+        ++m_solutionsFound;
+        return;
+    }
+
+    // escolhe o tile vazio com menos opções e o move para o fim da lista de tiles vazios
+    size_t chosenPosition = 0;
+    Mask chosenOptions = 0;
+    int fewestOptions = 10;
+    for (size_t position = 0; position < m_emptyTilesCount; ++position)
+    {
+        const auto options = getOptions(m_emptyTiles[position]);
+        const auto optionsCount = std::popcount(options);
+        if (optionsCount < fewestOptions)
+        {
+            fewestOptions = optionsCount;
+            chosenPosition = position;
+            chosenOptions = options;
+            if (optionsCount <= 1)
+            {
+                break;
+            }
+        }
+    }
+    if (fewestOptions == 0)
+    {
+        return;
+    }
+
+    --m_emptyTilesCount;
+    std::swap(m_emptyTiles[chosenPosition], m_emptyTiles[m_emptyTilesCount]);
+    const auto tileIndex = m_emptyTiles[m_emptyTilesCount];
+
+    for (const auto value : Suggestions::fromMask(chosenOptions))
+    {
+        place(tileIndex, value);
+        search();
+        unplace(tileIndex, value);
+        if (m_solutionsFound > 1)
+        {
+            break;
+        }
+    }
+
+    std::swap(m_emptyTiles[chosenPosition], m_emptyTiles[m_emptyTilesCount]);
+    ++m_emptyTilesCount;
+}
+
+SolutionsCount SolutionCounter::countSolutions(const GridState& gridState)
+{
+    AllowedValues allowedValues;
+    allowedValues.fill(Suggestions::allValues());
+    return countSolutions(gridState, allowedValues);
+}
+
+SolutionsCount SolutionCounter::countSolutions(const GridState& gridState, const AllowedValues& allowedValues)
+{
+    m_values.fill(0);
+    m_allowedValues = allowedValues;
+    m_rowsUsed.fill(0);
+    m_colsUsed.fill(0);
+    m_subgridsUsed.fill(0);
+    m_emptyTilesCount = 0;
+    m_solutionsFound = 0;
+    m_solution = GridState{};
+
+    for (BoardGeometry::TileIndex tileIndex = 0; tileIndex < BoardGeometry::TILES_COUNT; ++tileIndex)
+    {
+        const auto value = gridState.values[tileIndex];
+        if (value == 0)
+        {
+            m_emptyTiles[m_emptyTilesCount++] = tileIndex;
+            continue;
+        }
+        // valores repetidos em uma region tornam o board impossível
+        if (getUsedValues(tileIndex) & Suggestions::maskFor(value))
+        {
+            return SolutionsCount::NONE;
+        }
+        place(tileIndex, value);
+    }
+
+    search();
+
+    switch (m_solutionsFound)
+    {
+    case 0: return SolutionsCount::NONE;
+    case 1: return SolutionsCount::UNIQUE;
+    default: return SolutionsCount::MULTIPLE;
+    }
+}
+
+SolutionsCount SolutionCounter::countSolutions(const std::string& board)
+{
+    const auto parsedBoard = parseBoard(board);
+
+    GridState gridState;
+    AllowedValues allowedValues;
+    for (BoardGeometry::TileIndex tileIndex = 0; tileIndex < BoardGeometry::TILES_COUNT; ++tileIndex)
+    {
+        const auto& parsedTile = parsedBoard.tiles[tileIndex];
+        gridState.values[tileIndex] = parsedTile.value;
+        allowedValues[tileIndex] =
+            parsedTile.hasSuggestions ? parsedTile.suggestions : Suggestions::allValues();
+    }
+    return countSolutions(gridState, allowedValues);
+}
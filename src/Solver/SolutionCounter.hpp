@@ -0,0 +1,61 @@
+#ifndef __SOLUTIONCOUNTER_H__
+#define __SOLUTIONCOUNTER_H__
+
+#include "Board/BoardGeometry.hpp"
+#include "Board/GridState.hpp"
+#include "Suggestions.hpp"
+
+#include <array>
+#include <cstdint>
+#include <string>
+
+enum class SolutionsCount
+{
+    NONE,
+    UNIQUE,
+    MULTIPLE
+};
+
+std::string solutionsCountToString(SolutionsCount solutionsCount);
+
+// Counts the solutions of a board up to two, with a depth first search over row/column/subgrid masks that
+// always branches on the tile with the fewest options. Much cheaper than solving with the techniques, so it
+// can be used to reject boards without solution or with more than one before solving them.
+class SolutionCounter
+{
+  public:
+    using AllowedValues = std::array<Suggestions, BoardGeometry::TILES_COUNT>;
+
+    // every empty tile may take any value
+    SolutionsCount countSolutions(const GridState& gridState);
+    // each empty tile may only take the values of its entry in allowedValues
+    SolutionsCount countSolutions(const GridState& gridState, const AllowedValues& allowedValues);
+    // accepts the same format as Solver(const std::string&). Throws std::runtime_error for invalid boards
+    SolutionsCount countSolutions(const std::string& board);
+
+    // the first solution found by the last count, if there was one
+    const GridState& getSolution() const { return m_solution; }
+
+  private:
+    using Mask = Suggestions::MaskType;
+
+    std::array<TileValueType, BoardGeometry::TILES_COUNT> m_values{};
+    AllowedValues m_allowedValues{};
+    std::array<Mask, 9> m_rowsUsed{};
+    std::array<Mask, 9> m_colsUsed{};
+    std::array<Mask, 9> m_subgridsUsed{};
+
+    std::array<BoardGeometry::TileIndex, BoardGeometry::TILES_COUNT> m_emptyTiles{};
+    size_t m_emptyTilesCount{0};
+
+    size_t m_solutionsFound{0};
+    GridState m_solution;
+
+    Mask getUsedValues(BoardGeometry::TileIndex tileIndex) const;
+    Mask getOptions(BoardGeometry::TileIndex tileIndex) const;
+    void place(BoardGeometry::TileIndex tileIndex, TileValueType value);
+    void unplace(BoardGeometry::TileIndex tileIndex, TileValueType value);
+    void search();
+};
+
+#endif // __SOLUTIONCOUNTER_H__
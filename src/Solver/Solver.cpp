@@ -1,15 +1,22 @@
 #include "Solver.hpp"
 #include "Board/Tile.hpp"
+#include "BoardParser.hpp"
 #include "SolverTile.hpp"
-#include "Techniques/HiddenPairs.hpp"
+#include "Techniques/BoxLineReduction.hpp"
+#include "Techniques/FinnedFish.hpp"
+#include "Techniques/Fish.hpp"
+#include "Techniques/HiddenSubsets.hpp"
 #include "Techniques/HiddenUniqueRectangles.hpp"
-#include "Techniques/NakedPairs.hpp"
-#include "Techniques/NakedTriples.hpp"
+#include "Techniques/Medusa3D.hpp"
+#include "Techniques/NakedSubsets.hpp"
 #include "Techniques/PointingPair.hpp"
 #include "Techniques/SinglesChains.hpp"
 #include "Techniques/SinglesRegion.hpp"
 #include "Techniques/SinglesTile.hpp"
 #include "Techniques/UniqueRectangles.hpp"
+#include "Techniques/WWing.hpp"
+#include "Techniques/XYWing.hpp"
+#include "Techniques/XYZWing.hpp"
 
 #include <algorithm>
 #include <array>
@@ -35,86 +42,102 @@ std::shared_ptr<Subgrid> SolverComponentsContructor::createSubgrid(Grid* grid, c
     return std::static_pointer_cast<Subgrid>(std::make_shared<SolverSubgrid>(grid, index));
 }
 
-std::shared_ptr<Tile> SolverComponentsContructor::createTileCopy(Grid* grid,
-                                                                 const std::shared_ptr<Tile>& tile) const
-{
-    return std::make_shared<SolverTile>(*std::dynamic_pointer_cast<SolverTile>(tile), grid);
-}
-std::shared_ptr<Line> SolverComponentsContructor::createLineCopy(Grid* grid,
-                                                                 const std::shared_ptr<Line>& line) const
-{
-    return std::make_shared<SolverLine>(*std::dynamic_pointer_cast<SolverLine>(line), grid);
-}
-std::shared_ptr<Subgrid>
-SolverComponentsContructor::createSubgridCopy(Grid* grid, const std::shared_ptr<Subgrid>& subgrid) const
-{
-    return std::make_shared<SolverSubgrid>(*std::dynamic_pointer_cast<SolverSubgrid>(subgrid), grid);
-}
-
 Solver::Solver()
     : Grid(std::make_shared<SolverComponentsContructor>())
 {
+    // os tiles são sempre SolverTiles, criados pelo SolverComponentsContructor
+    for (const auto& tile : m_gridTiles)
+    {
+        m_solverTiles[tile->getIndex()] = std::static_pointer_cast<SolverTile>(tile);
+    }
+    initializeSolverRegions();
+    bindSuggestionsToState();
     initialize();
 }
 
 Solver::Solver(const std::string& fromBoard)
-    : Grid(std::make_shared<SolverComponentsContructor>())
+    : Solver()
+{
+    loadBoard(fromBoard);
+}
+
+Solver::~Solver() {}
+
+void Solver::loadBoard(const std::string& fromBoard)
 {
-    size_t currentIndex = 0;
-    size_t currentTileIndex = 0;
-    while (currentIndex < fromBoard.size())
+    setState(SolverState{});
+    m_searchStatistics = SearchStatistics{};
+    for (auto& technique : m_techniques) { technique->resetStatistics(); }
+    m_solutionsCount.reset();
+
+    const auto parsedBoard = parseBoard(fromBoard);
+    m_initializedWithSuggestions = parsedBoard.hasSuggestions;
+
+    // os tiles são aplicados em ordem: um valor remove a sugestão dos tiles anteriores que o enxergam
+    for (BoardGeometry::TileIndex tileIndex = 0; tileIndex < BoardGeometry::TILES_COUNT; ++tileIndex)
     {
-        const auto& currentTile = this->operator()(currentTileIndex / 9, currentTileIndex % 9);
-        ++currentTileIndex;
-        const auto& currentToken = fromBoard[currentIndex];
-        switch (currentToken)
+        const auto& parsedTile = parsedBoard.tiles[tileIndex];
+        const auto& currentTile =
+            this->operator()(BoardGeometry::getRow(tileIndex), BoardGeometry::getCol(tileIndex));
+        for (const auto suggestion : parsedTile.suggestions) { currentTile->addSuggestion(suggestion); }
+        if (parsedTile.value != 0)
         {
-        case '{':
-        {
-            m_initializedWithSuggestions = true;
-            const auto endingSuggestionIndex = fromBoard.find('}', currentIndex);
-            if (endingSuggestionIndex == std::string::npos)
-            {
-                throw std::runtime_error(
-                    fmt::format("Missing closing bracket for suggestion at tile index {}", currentTileIndex));
-            }
-            const auto suggestionsString =
-                fromBoard.substr(currentIndex + 1, endingSuggestionIndex - currentIndex - 1);
-            for (const auto& suggestion : suggestionsString)
-            {
-                const auto value = static_cast<TileValueType>(suggestion - '0');
-                if (value < 1 || value > 9)
-                {
-                    throw std::runtime_error(
-                        fmt::format("Invalid suggestion value {} at tile index {}", value, currentTileIndex));
-                }
-                currentTile->addSuggestion(value);
-            }
-            currentIndex = endingSuggestionIndex + 1;
-            break;
+            currentTile->setValue(parsedTile.value);
         }
-        default:
+    }
+}
+
+void Solver::bindSuggestionsToState()
+{
+    for (auto& tile : m_gridTiles)
+    {
+        const auto solverTile = std::static_pointer_cast<SolverTile>(tile);
+        auto& suggestions = m_suggestionsState.tilesSuggestions[solverTile->getIndex()];
+        suggestions = solverTile->getSuggestions();
+        solverTile->setSuggestionsStorage(&suggestions);
+        solverTile->setTrail(&m_trail);
+        solverTile->setChangeTracker(&m_changeTracker);
+        solverTile->setSinglesQueue(&m_singlesQueue);
+        solverTile->setValuesPositions(&m_suggestionsState.valuesPositions);
+        solverTile->setBivalueTiles(&m_suggestionsState.bivalueTiles);
+        for (const auto suggestion : suggestions)
         {
-            ++currentIndex;
-            if (currentToken == '.' || currentToken == '0')
-            {
-                break;
-            }
-            const auto value = static_cast<TileValueType>(currentToken - '0');
-            if (value < 0 || value > 9)
-            {
-                throw std::runtime_error(
-                    fmt::format("Invalid tile value {} at tile index {}", value, currentTileIndex));
-            }
-            currentTile->setValue(value);
-        }
+            m_suggestionsState.valuesPositions.add(solverTile->getIndex(), suggestion);
         }
+        m_suggestionsState.bivalueTiles.update(solverTile->getIndex(), Suggestions{}, suggestions);
+    }
+    for (const auto& region : getAllRegions())
+    {
+        auto& suggestionsQuan = m_suggestionsState.regionsSuggestionsQuan[BoardGeometry::toRegionIndex(
+            region->getRegionSpecificType(), static_cast<TileValueType>(region->getIndex()))];
+        suggestionsQuan = region->getSuggestionsQuan();
+        region->setSuggestionsQuanStorage(&suggestionsQuan);
     }
+}
 
-    initialize();
+SolverState Solver::getState() const
+{
+    return SolverState{getGridState(), m_suggestionsState, m_initializedWithSuggestions};
 }
 
-Solver::~Solver() {}
+void Solver::setState(const SolverState& state)
+{
+    setGridState(state.grid);
+    m_suggestionsState = state.suggestions;
+    m_initializedWithSuggestions = state.initializedWithSuggestions;
+    m_changeTracker.markAllChanged();
+    m_singlesQueue.requestRefill();
+    m_trail.clear();
+}
+
+SinglesQueue& Solver::getSinglesQueue()
+{
+    if (m_singlesQueue.needsRefill())
+    {
+        m_singlesQueue.refill(getGridState(), m_suggestionsState);
+    }
+    return m_singlesQueue;
+}
 
 void Solver::computeAllSuggestions(const bool clear)
 {
@@ -123,8 +146,9 @@ void Solver::computeAllSuggestions(const bool clear)
         if (tile->hasValue())
             continue;
         // cast tile to SolverTilePtr and call computeSuggestions
-        std::dynamic_pointer_cast<SolverTile>(tile)->computeSuggestions(clear);
+        std::static_pointer_cast<SolverTile>(tile)->computeSuggestions(clear);
     }
+    m_singlesQueue.requestRefill();
 }
 
 #define INIT_TECHNIQUE(TechniqueType) m_techniques.emplace_back(std::make_unique<TechniqueType>(*this));
@@ -135,28 +159,67 @@ void Solver::initializeTechniques()
     INIT_TECHNIQUE(SinglesTile);
     INIT_TECHNIQUE(SinglesRegion);
     INIT_TECHNIQUE(PointingPair);
-    INIT_TECHNIQUE(HiddenPairs);
-    INIT_TECHNIQUE(NakedPairs);
-    INIT_TECHNIQUE(NakedTriples);
+    INIT_TECHNIQUE(BoxLineReduction);
+    INIT_TECHNIQUE(NakedSubsets);
+    INIT_TECHNIQUE(HiddenSubsets);
+    INIT_TECHNIQUE(Fish);
+    INIT_TECHNIQUE(XYWing);
+    INIT_TECHNIQUE(XYZWing);
+    INIT_TECHNIQUE(WWing);
     INIT_TECHNIQUE(SinglesChains);
+    INIT_TECHNIQUE(FinnedFish);
+    INIT_TECHNIQUE(Medusa3D);
     INIT_TECHNIQUE(UniqueRectangles);
     INIT_TECHNIQUE(HiddenUniqueRectangles);
 }
 
-void Solver::solve()
+void Solver::prepareSuggestions()
 {
-    std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
     if (!m_initializedWithSuggestions)
     {
         computeAllSuggestions();
+        m_initializedWithSuggestions = true;
     }
-    printGrid();
+}
+
+SolutionsCount Solver::countSolutions()
+{
+    prepareSuggestions();
+
+    SolutionCounter::AllowedValues allowedValues;
+    std::copy(m_suggestionsState.tilesSuggestions.begin(),
+              m_suggestionsState.tilesSuggestions.end(),
+              allowedValues.begin());
+    SolutionCounter solutionCounter;
+    return solutionCounter.countSolutions(getGridState(), allowedValues);
+}
+
+bool Solver::checkSolutionsCount()
+{
+    if (!m_solutionsCountCheckEnabled)
+    {
+        return true;
+    }
+    m_solutionsCount = countSolutions();
+    return m_solutionsCount != SolutionsCount::NONE;
+}
+
+Solver::PropagationResult Solver::propagate()
+{
     // checar enquanto o board não tiver solucionado
     while (!isSolved())
     {
+        if (hasContradiction())
+        {
+            return PropagationResult::CONTRADICTION;
+        }
         bool performed = false;
         for (auto&& technique : m_techniques)
         {
+            if (m_solutionsCount == SolutionsCount::MULTIPLE && technique->requiresUniqueSolution())
+            {
+                continue;
+            }
             performed = technique->run();
             if (performed)
             {
@@ -166,87 +229,290 @@ void Solver::solve()
         }
         if (!performed)
         {
-            std::cout << "\nNão foi possível resolver o board!" << std::endl;
-            return;
+            return PropagationResult::STALLED;
         }
     }
+    return PropagationResult::SOLVED;
+}
+
+bool Solver::hasContradiction() const
+{
+    const auto& values = getGridState().values;
+    for (BoardGeometry::TileIndex tileIndex = 0; tileIndex < BoardGeometry::TILES_COUNT; ++tileIndex)
+    {
+        if (values[tileIndex] == 0 && m_suggestionsState.tilesSuggestions[tileIndex].empty())
+        {
+            return true;
+        }
+    }
+    // todo valor precisa estar colocado ou ser sugestão de algum tile de cada region
+    for (BoardGeometry::RegionIndex regionIndex = 0; regionIndex < BoardGeometry::REGIONS_COUNT;
+         ++regionIndex)
+    {
+        auto coveredValues = m_suggestionsState.regionsSuggestionsQuan[regionIndex].getValidSuggestions();
+        for (const auto tileIndex : BoardGeometry::REGION_TILES[regionIndex])
+        {
+            if (values[tileIndex] != 0)
+            {
+                coveredValues.insert(values[tileIndex]);
+            }
+        }
+        if (coveredValues != Suggestions::allValues())
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+SolverTilePtr Solver::findTileWithFewestSuggestions() const
+{
+    SolverTilePtr result;
+    unsigned short fewestSuggestions = 10;
+    for (const auto& tile : m_gridTiles)
+    {
+        if (tile->hasValue())
+        {
+            continue;
+        }
+        auto solverTile = std::static_pointer_cast<SolverTile>(tile);
+        const auto suggestionsCount = solverTile->getSuggestionsCount();
+        if (suggestionsCount < fewestSuggestions)
+        {
+            fewestSuggestions = suggestionsCount;
+            result = std::move(solverTile);
+            if (fewestSuggestions == 2)
+            {
+                break;
+            }
+        }
+    }
+    return result;
+}
+
+SolverTrail::Checkpoint Solver::checkpoint()
+{
+    return m_trail.openCheckpoint();
+}
+
+void Solver::rollback(const SolverTrail::Checkpoint checkpoint)
+{
+    m_trail.checkInnermostCheckpoint(checkpoint);
+    undoTrailTo(checkpoint);
+    m_trail.closeCheckpoint(checkpoint);
+}
+
+void Solver::commit(const SolverTrail::Checkpoint checkpoint)
+{
+    m_trail.closeCheckpoint(checkpoint);
+}
+
+void Solver::undoTrailTo(const SolverTrail::Checkpoint checkpoint)
+{
+    while (m_trail.getCheckpoint() > checkpoint)
+    {
+        const auto entry = m_trail.pop();
+        const auto& tile =
+            m_gridTiles(BoardGeometry::getRow(entry.tileIndex), BoardGeometry::getCol(entry.tileIndex));
+        std::static_pointer_cast<SolverTile>(tile)->restore(entry.value, entry.suggestions);
+    }
+    // os singles da fila podem não valer mais para o estado restaurado
+    m_singlesQueue.requestRefill();
+}
+
+bool Solver::searchSolution()
+{
+    const auto begin = std::chrono::steady_clock::now();
+
+    // os branches que falham são desfeitos dentro da busca, então basta fechar o checkpoint
+    const auto searchCheckpoint = checkpoint();
+    const bool solved = searchSolution(1);
+    commit(searchCheckpoint);
+
+    m_searchStatistics.elapsedTime += std::chrono::steady_clock::now() - begin;
+    return solved;
+}
+
+bool Solver::searchSolution(const unsigned int depth)
+{
+    ++m_searchStatistics.nodesCount;
+    m_searchStatistics.maxDepth = std::max(m_searchStatistics.maxDepth, depth);
+
+    const auto tile = findTileWithFewestSuggestions();
+    // copia, já que as sugestões do tile mudam ao definir o valor
+    const Suggestions candidates = tile->getSuggestions();
+    for (const auto value : candidates)
+    {
+        const auto checkpoint = m_trail.getCheckpoint();
+        tile->setValue(value);
+
+        const auto result = propagate();
+        m_searchStatistics.maxTrailSize = std::max(m_searchStatistics.maxTrailSize, m_trail.getCheckpoint());
+        if (result == PropagationResult::SOLVED ||
+            (result == PropagationResult::STALLED && searchSolution(depth + 1)))
+        {
+            return true;
+        }
+
+        undoTrailTo(checkpoint);
+        ++m_searchStatistics.backtracksCount;
+    }
+    return false;
+}
+
+bool Solver::trySolve()
+{
+    prepareSuggestions();
+    if (!checkSolutionsCount())
+    {
+        return false;
+    }
+    switch (propagate())
+    {
+    case PropagationResult::SOLVED: return true;
+    case PropagationResult::CONTRADICTION: return false;
+    case PropagationResult::STALLED: return m_searchFallbackEnabled && searchSolution();
+    }
+    return false;
+}
+
+void Solver::solve()
+{
+    std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+    prepareSuggestions();
+    printGrid();
+
+    if (!checkSolutionsCount())
+    {
+        std::cout << "\nO board não tem solução!" << std::endl;
+        return;
+    }
+    if (m_solutionsCount == SolutionsCount::MULTIPLE)
+    {
+        std::cout << "\nO board tem mais de uma solução, as técnicas de unicidade não serão usadas."
+                  << std::endl;
+    }
+
+    bool solved = false;
+    bool usedSearch = false;
+    switch (propagate())
+    {
+    case PropagationResult::SOLVED: solved = true; break;
+    case PropagationResult::CONTRADICTION: break;
+    case PropagationResult::STALLED:
+        usedSearch = m_searchFallbackEnabled;
+        solved = usedSearch && searchSolution();
+        break;
+    }
+    if (!solved)
+    {
+        std::cout << "\nNão foi possível resolver o board!" << std::endl;
+        return;
+    }
     std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
     std::cout << "\nBoard resolvido em "
               << std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count()
               << " milisegundos." << std::endl;
 
     fmt::print("\nTechniques report:\n");
-    for (const auto& technique : m_techniques)
+    if constexpr (TECHNIQUE_STATISTICS_ENABLED)
     {
-        fmt::print("  {:<20}: {}\n", technique->getTechniqueName(), technique->getRanCount());
+        fmt::print("{}", getTechniquesReport().toString());
+    }
+    else
+    {
+        for (const auto& technique : m_techniques)
+        {
+            fmt::print("  {:<20}: {}\n", technique->getTechniqueName(), technique->getRanCount());
+        }
+    }
+    if (usedSearch)
+    {
+        fmt::print("\nSearch report:\n");
+        const auto searchTime =
+            std::chrono::duration_cast<std::chrono::microseconds>(m_searchStatistics.elapsedTime);
+        fmt::print("  nodes: {}, backtracks: {}, max depth: {}, max trail size: {}, time: {}us\n",
+                   m_searchStatistics.nodesCount,
+                   m_searchStatistics.backtracksCount,
+                   m_searchStatistics.maxDepth,
+                   m_searchStatistics.maxTrailSize,
+                   searchTime.count());
     }
 }
 
-void Solver::initialize()
+TechniquesReport Solver::getTechniquesReport() const
 {
-    // initialize techniques
-    initializeTechniques();
+    TechniquesReport report;
+    report.techniques.reserve(m_techniques.size());
+    for (const auto& technique : m_techniques)
+    {
+        report.techniques.push_back({technique->getTechniqueName(),
+                                     technique->getTier(),
+                                     technique->getStatistics(),
+                                     technique->getRanCount()});
+    }
+    return report;
 }
 
-const std::vector<std::shared_ptr<SolverRegion>>& Solver::getAllRegions() const
+size_t Solver::getCandidatesCount() const
 {
-    if (m_allSolverRegions.empty())
+    size_t candidatesCount = 0;
+    for (const auto& suggestions : m_suggestionsState.tilesSuggestions)
     {
-        const auto& solverSubgrids = getAllSolverSubgrids();
-        m_allSolverRegions.insert(m_allSolverRegions.end(), solverSubgrids.begin(), solverSubgrids.end());
-        const auto& solverHorizontalLines = getAllSolverHorizontalLines();
-        m_allSolverRegions.insert(
-            m_allSolverRegions.end(), solverHorizontalLines.begin(), solverHorizontalLines.end());
-        const auto& solverVerticalLines = getAllSolverVerticalLines();
-        m_allSolverRegions.insert(
-            m_allSolverRegions.end(), solverVerticalLines.begin(), solverVerticalLines.end());
+        candidatesCount += suggestions.size();
     }
-    return m_allSolverRegions;
+    return candidatesCount;
 }
 
-const std::vector<std::shared_ptr<SolverSubgrid>>& Solver::getAllSolverSubgrids() const
+size_t Solver::getValuesCount() const
 {
-    if (m_allSolverSubgrids.empty())
-    {
-        const auto& subgrids = getSubgrids();
-        std::transform(subgrids.begin(),
-                       subgrids.end(),
-                       std::back_inserter(m_allSolverSubgrids),
-                       [](const auto& subgrid) { return std::dynamic_pointer_cast<SolverSubgrid>(subgrid); });
-    }
-    return m_allSolverSubgrids;
+    const auto& values = getGridState().values;
+    return static_cast<size_t>(std::count_if(values.begin(), values.end(), [](const auto value) {
+        return value != 0;
+    }));
 }
 
-const std::vector<std::shared_ptr<SolverLine>>& Solver::getAllSolverHorizontalLines() const
+void Solver::initialize()
 {
-    if (m_allSolverHorizontalLines.empty())
-    {
-        const auto& horizontalLines = getHorizontalLines();
-        std::transform(horizontalLines.begin(),
-                       horizontalLines.end(),
-                       std::back_inserter(m_allSolverHorizontalLines),
-                       [](const auto& line) { return std::dynamic_pointer_cast<SolverLine>(line); });
-    }
-    return m_allSolverHorizontalLines;
+    // initialize techniques
+    initializeTechniques();
 }
 
-const std::vector<std::shared_ptr<SolverLine>>& Solver::getAllSolverVerticalLines() const
+void Solver::initializeSolverRegions()
 {
-    if (m_allSolverVerticalLines.empty())
+    // as regiões são sempre criadas pelo SolverComponentsContructor
+    const auto& subgrids = getSubgrids();
+    m_allSolverSubgrids.reserve(subgrids.size());
+    for (const auto& subgrid : subgrids)
     {
-        const auto& verticalLines = getVerticalLines();
-        std::transform(verticalLines.begin(),
-                       verticalLines.end(),
-                       std::back_inserter(m_allSolverVerticalLines),
-                       [](const auto& line) { return std::dynamic_pointer_cast<SolverLine>(line); });
+        m_allSolverSubgrids.emplace_back(std::static_pointer_cast<SolverSubgrid>(subgrid));
     }
-    return m_allSolverVerticalLines;
+    const auto& horizontalLines = getHorizontalLines();
+    m_allSolverHorizontalLines.reserve(horizontalLines.size());
+    for (const auto& line : horizontalLines)
+    {
+        m_allSolverHorizontalLines.emplace_back(std::static_pointer_cast<SolverLine>(line));
+    }
+    const auto& verticalLines = getVerticalLines();
+    m_allSolverVerticalLines.reserve(verticalLines.size());
+    for (const auto& line : verticalLines)
+    {
+        m_allSolverVerticalLines.emplace_back(std::static_pointer_cast<SolverLine>(line));
+    }
+
+    m_allSolverRegions.reserve(BoardGeometry::REGIONS_COUNT);
+    m_allSolverRegions.insert(
+        m_allSolverRegions.end(), m_allSolverSubgrids.begin(), m_allSolverSubgrids.end());
+    m_allSolverRegions.insert(
+        m_allSolverRegions.end(), m_allSolverHorizontalLines.begin(), m_allSolverHorizontalLines.end());
+    m_allSolverRegions.insert(
+        m_allSolverRegions.end(), m_allSolverVerticalLines.begin(), m_allSolverVerticalLines.end());
 }
 
 std::vector<std::string> Solver::requestTileDisplayStringForCoordinate(const TileValueType row,
                                                                        const TileValueType col) const
 {
-    const auto solverTile = std::dynamic_pointer_cast<SolverTile>(m_gridTiles(row, col));
+    const auto& solverTile = m_solverTiles[BoardGeometry::toTileIndex(row, col)];
     if (solverTile->hasValue())
     {
         return Grid::requestTileDisplayStringForCoordinate(row, col);
@@ -278,11 +544,11 @@ std::vector<std::string> Solver::requestTileDisplayStringForCoordinate(const Til
     return result;
 }
 
-SolverTilePtr Solver::operator()(TileValueType row, TileValueType col) const
+const SolverTilePtr& Solver::operator()(TileValueType row, TileValueType col) const
 {
-    return std::dynamic_pointer_cast<SolverTile>(Grid::operator()(row, col));
+    return m_solverTiles[BoardGeometry::toTileIndex(row, col)];
 }
-SolverTilePtr Solver::operator()(const Coordinates& coordinates) const
+const SolverTilePtr& Solver::operator()(const Coordinates& coordinates) const
 {
-    return std::dynamic_pointer_cast<SolverTile>(Grid::operator()(coordinates));
+    return m_solverTiles[BoardGeometry::toTileIndex(coordinates)];
 }
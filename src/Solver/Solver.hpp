@@ -2,10 +2,18 @@
 #define __SOLVER_H__
 
 #include "Board/Grid.hpp"
+#include "ChangeTracker.hpp"
 #include "Reporter.hpp"
+#include "SinglesQueue.hpp"
+#include "SolutionCounter.hpp"
+#include "SolverState.hpp"
+#include "SolverTrail.hpp"
+#include "TechniqueStatistics.hpp"
 
 #include <array>
+#include <chrono>
 #include <memory>
+#include <optional>
 #include <vector>
 
 class Technique;
@@ -16,26 +24,69 @@ class SolverComponentsContructor : public ComponentsConstructor
     std::shared_ptr<Tile> createTile(Grid* grid, TileValueType row, TileValueType col) const override;
     std::shared_ptr<Line> createLine(Grid* grid, LineOrientation row, short index) const override;
     std::shared_ptr<Subgrid> createSubgrid(Grid* grid, short index) const override;
+};
 
-    std::shared_ptr<Tile> createTileCopy(Grid* grid, const std::shared_ptr<Tile>& tile) const override;
-    std::shared_ptr<Line> createLineCopy(Grid* grid, const std::shared_ptr<Line>& line) const override;
-    std::shared_ptr<Subgrid> createSubgridCopy(Grid* grid,
-                                               const std::shared_ptr<Subgrid>& subgrid) const override;
+// Cost of the search used when the techniques can't make progress
+struct SearchStatistics
+{
+    size_t nodesCount{0};
+    size_t backtracksCount{0};
+    unsigned int maxDepth{0};
+    size_t maxTrailSize{0};
+    std::chrono::nanoseconds elapsedTime{0};
 };
 
 class Solver : public Grid
 {
   private:
-    mutable std::vector<std::shared_ptr<SolverRegion>> m_allSolverRegions;
-
-    mutable std::vector<std::shared_ptr<SolverSubgrid>> m_allSolverSubgrids;
-    mutable std::vector<std::shared_ptr<SolverLine>> m_allSolverHorizontalLines;
-    mutable std::vector<std::shared_ptr<SolverLine>> m_allSolverVerticalLines;
+    enum class PropagationResult
+    {
+        SOLVED,
+        STALLED,
+        CONTRADICTION
+    };
+
+    SuggestionsState m_suggestionsState;
+    SolverTrail m_trail;
+    ChangeTracker m_changeTracker;
+    SinglesQueue m_singlesQueue;
+    SearchStatistics m_searchStatistics;
+    bool m_searchFallbackEnabled{true};
+    bool m_solutionsCountCheckEnabled{true};
+    std::optional<SolutionsCount> m_solutionsCount;
+
+    // the tiles of the grid, already typed, indexed as described in BoardGeometry
+    std::array<SolverTilePtr, BoardGeometry::TILES_COUNT> m_solverTiles;
+
+    // the regions of the grid, already typed and built once on construction. m_allSolverRegions is indexed
+    // as described in BoardGeometry
+    std::vector<std::shared_ptr<SolverRegion>> m_allSolverRegions;
+
+    std::vector<std::shared_ptr<SolverSubgrid>> m_allSolverSubgrids;
+    std::vector<std::shared_ptr<SolverLine>> m_allSolverHorizontalLines;
+    std::vector<std::shared_ptr<SolverLine>> m_allSolverVerticalLines;
 
     std::vector<std::unique_ptr<Technique>> m_techniques;
 
     void initialize();
+    void initializeSolverRegions();
     void initializeTechniques();
+    void prepareSuggestions();
+    // counts the solutions before solving. Returns false if the board has no solution
+    bool checkSolutionsCount();
+
+    // runs the techniques until the board is solved or none of them makes progress
+    PropagationResult propagate();
+    bool hasContradiction() const;
+
+    // branches on the tile with the fewest suggestions, propagating with the techniques on every node and
+    // undoing the failed branches through the trail
+    bool searchSolution();
+    bool searchSolution(unsigned int depth);
+    SolverTilePtr findTileWithFewestSuggestions() const;
+    // undoes the trail entries recorded after the checkpoint, without closing it
+    void undoTrailTo(SolverTrail::Checkpoint checkpoint);
+    void bindSuggestionsToState();
 
     std::shared_ptr<Reporter> m_reporter;
 
@@ -49,10 +100,19 @@ class Solver : public Grid
     const std::array<SolverRegion* const, 3> getSolverRegions(const Tile& tile);
     const std::array<const SolverRegion* const, 3> getSolverRegions(const Tile& tile) const;
 
-    const std::vector<std::shared_ptr<SolverRegion>>& getAllRegions() const;
-    const std::vector<std::shared_ptr<SolverSubgrid>>& getAllSolverSubgrids() const;
-    const std::vector<std::shared_ptr<SolverLine>>& getAllSolverHorizontalLines() const;
-    const std::vector<std::shared_ptr<SolverLine>>& getAllSolverVerticalLines() const;
+    const std::vector<std::shared_ptr<SolverRegion>>& getAllRegions() const { return m_allSolverRegions; }
+    const std::vector<std::shared_ptr<SolverSubgrid>>& getAllSolverSubgrids() const
+    {
+        return m_allSolverSubgrids;
+    }
+    const std::vector<std::shared_ptr<SolverLine>>& getAllSolverHorizontalLines() const
+    {
+        return m_allSolverHorizontalLines;
+    }
+    const std::vector<std::shared_ptr<SolverLine>>& getAllSolverVerticalLines() const
+    {
+        return m_allSolverVerticalLines;
+    }
 
     void computeAllSuggestions(const bool clear = false);
     void computeTileSuggestions(const Tile& tile, const bool clear = false);
@@ -60,8 +120,6 @@ class Solver : public Grid
     bool
     canPlaceValueInTile(const Tile& tile, const TileValueType value, const bool forceCheck = false) const;
 
-    friend int main();
-
     void setReporter(const std::shared_ptr<Reporter>& reporter) { m_reporter = reporter; }
 
     template<typename FormatString, typename... Args>
@@ -74,8 +132,41 @@ class Solver : public Grid
         }
     }
 
-    SolverTilePtr operator()(TileValueType row, TileValueType col) const;
-    SolverTilePtr operator()(const Coordinates& coordinates) const;
+    const SolverTilePtr& operator()(TileValueType row, TileValueType col) const;
+    const SolverTilePtr& operator()(const Coordinates& coordinates) const;
+
+    // when each tile and region last changed, used by the techniques to skip what didn't change
+    ChangeTracker& getChangeTracker() { return m_changeTracker; }
+    // singles found while removing suggestions, consumed by SinglesTile and SinglesRegion
+    SinglesQueue& getSinglesQueue();
+
+    // where the suggestions of each value are, by row and by column
+    const ValuesPositions& getValuesPositions() const { return m_suggestionsState.valuesPositions; }
+    // tiles with exactly two suggestions, by pair of suggestions
+    const BivalueTiles& getBivalueTiles() const { return m_suggestionsState.bivalueTiles; }
+    const std::array<Suggestions, BoardGeometry::TILES_COUNT>& getTilesSuggestions() const
+    {
+        return m_suggestionsState.tilesSuggestions;
+    }
+
+    SolverState getState() const;
+    // discards all the open checkpoints
+    void setState(const SolverState& state);
+
+    // Starts recording every change made to the tiles (values, suggestions and the suggestions quantity
+    // of their regions), so they can be undone in O(changes) instead of copying the board. Checkpoints can
+    // be nested and each one must be closed, innermost first, by rollback or commit
+    SolverTrail::Checkpoint checkpoint();
+    // undoes all the changes made after the checkpoint and closes it
+    void rollback(SolverTrail::Checkpoint checkpoint);
+    // keeps the changes made after the checkpoint and closes it. They can still be undone by rolling back
+    // an outer checkpoint
+    void commit(SolverTrail::Checkpoint checkpoint);
+    size_t getOpenCheckpointsCount() const { return m_trail.getOpenCheckpointsCount(); }
+
+    // clears the board and loads a new one, in the same format accepted by Solver(const std::string&).
+    // Allows the same Solver to be reused for several boards
+    void loadBoard(const std::string& fromBoard);
 
   public:
     Solver();
@@ -83,6 +174,31 @@ class Solver : public Grid
     ~Solver();
 
     void solve();
+    // solves without printing anything. Returns true if the board was solved
+    bool trySolve();
+
+    // when enabled (default), boards that the techniques can't solve are finished with a search
+    void setSearchFallbackEnabled(bool enabled) { m_searchFallbackEnabled = enabled; }
+    bool isSearchFallbackEnabled() const { return m_searchFallbackEnabled; }
+    const SearchStatistics& getSearchStatistics() const { return m_searchStatistics; }
+    // what each technique did since the board was loaded
+    TechniquesReport getTechniquesReport() const;
+
+    // suggestions of all the empty tiles
+    size_t getCandidatesCount() const;
+    // tiles with a value
+    size_t getValuesCount() const;
+
+    // counts (up to 2) the solutions of the current board, respecting the suggestions of its empty tiles
+    SolutionsCount countSolutions();
+
+    // when enabled (default), the solutions are counted before solving: boards without solution are
+    // rejected right away and boards with more than one solution are solved without the uniqueness
+    // techniques, whose eliminations would be wrong for them
+    void setSolutionsCountCheckEnabled(bool enabled) { m_solutionsCountCheckEnabled = enabled; }
+    bool isSolutionsCountCheckEnabled() const { return m_solutionsCountCheckEnabled; }
+    // result of the check of the last solve, if it was done
+    const std::optional<SolutionsCount>& getSolutionsCount() const { return m_solutionsCount; }
 };
 
 #endif // __SOLVER_H__
\ No newline at end of file
@@ -5,13 +5,15 @@
 #include "Board/Grid.hpp"
 #include "Board/Line.hpp"
 #include "Board/Region.hpp"
+#include "Board/BoardGeometry.hpp"
 #include "Board/Subgrid.hpp"
 #include "SolverTypes.hpp"
+#include "Suggestions.hpp"
 #include "SuggestionsQuantity.hpp"
 
+#include <bit>
 #include <map>
 #include <optional>
-#include <unordered_set>
 
 class Solver;
 class Line;
@@ -22,10 +24,19 @@ class SolverRegion : virtual public Region
 {
   private:
     // Suggestions m_missing{1, 2, 3, 4, 5, 6, 7, 8, 9};
-    mutable std::unique_ptr<SolverTileVec> m_solverTiles;
+    // the tiles of the region, typed once when the region is created
+    SolverTileVec m_solverTiles;
+
+    // the regions owned by a Solver keep their suggestions quantity in the SuggestionsState of that
+    // Solver. m_detachedSuggestionsQuan is only used by regions that were not bound to one
+    SuggestionsQuantity m_detachedSuggestionsQuan;
+    SuggestionsQuantity* m_suggestionsQuan{&m_detachedSuggestionsQuan};
+
+    void takeSuggestionsQuanFrom(SolverRegion& other);
 
   protected:
-    SuggestionsQuantity m_suggestionsQuan;
+    // called by the derived regions, once their tiles are set
+    void initializeSolverTiles();
 
   public:
     SolverRegion() = delete;
@@ -36,15 +47,19 @@ class SolverRegion : virtual public Region
 
     Solver* getSolver() const;
 
-    const SolverTileVec& getSolverTiles() const;
+    const SolverTileVec& getSolverTiles() const { return m_solverTiles; }
 
     // Returns a map telling how many times each value is missing in this region
-    const SuggestionsQuantity& getSuggestionsQuan() const { return m_suggestionsQuan; }
+    const SuggestionsQuantity& getSuggestionsQuan() const { return *m_suggestionsQuan; }
+    void setSuggestionsQuanStorage(SuggestionsQuantity* suggestionsQuanStorage)
+    {
+        m_suggestionsQuan = suggestionsQuanStorage;
+    }
 
     void suggestionAdded(const unsigned value);
     void suggestionRemoved(const unsigned value);
 
-    bool removeSuggestionsFromTiles(const std::vector<TileValueType>& values,
+    bool removeSuggestionsFromTiles(const Suggestions& values,
                                     const std::optional<SolverTileVec>& exceptFromTiles = std::nullopt);
 
     bool removeSingleSuggestionFromTiles(TileValueType values,
@@ -55,12 +70,9 @@ class SolverRegion : virtual public Region
 
     SolverTileVec getTilesWithSuggestion(TileValueType value) const;
 
-    SolverTileVec getTilesWithAllSuggestions(const std::vector<TileValueType>& suggestions) const;
+    SolverTileVec getTilesWithAllSuggestions(const Suggestions& suggestions) const;
 
     TileValueType getSuggestionsQuanFor(TileValueType value) const;
-
-    SolverTileVec findLockedSetOfSuggestions(const std::unordered_set<TileValueType>& values) const;
-    std::vector<SolverTileVec> findLockedSetsOfSize(unsigned short n) const;
 };
 
 class SolverLine
@@ -70,7 +82,6 @@ class SolverLine
   private:
   public:
     SolverLine(Grid* grid, LineOrientation orientation, const short index);
-    SolverLine(const SolverLine& other, Grid* grid);
     SolverLine(SolverLine&& other) = default;
     SolverLine& operator=(SolverLine&& other) = default;
     ~SolverLine() {}
@@ -83,10 +94,49 @@ class SolverSubgrid
   private:
   public:
     SolverSubgrid(Grid* grid, const short index);
-    SolverSubgrid(const SolverSubgrid& other, Grid* grid);
     SolverSubgrid(SolverSubgrid&& other) = default;
     SolverSubgrid& operator=(SolverSubgrid&& other) = default;
     ~SolverSubgrid() {}
 };
 
+// The regions of a RegionMask, iterated in index order over all the regions of a Solver (see
+// Solver::getAllRegions)
+class SolverRegionsSubset
+{
+  public:
+    struct const_iterator
+    {
+        const std::shared_ptr<SolverRegion>* m_regions{nullptr};
+        BoardGeometry::RegionMask m_remaining{0};
+
+        const std::shared_ptr<SolverRegion>& operator*() const
+        {
+            return m_regions[std::countr_zero(m_remaining)];
+        }
+        const_iterator& operator++()
+        {
+            m_remaining &= m_remaining - 1;
+            return *this;
+        }
+        bool operator==(const const_iterator& other) const { return m_remaining == other.m_remaining; }
+        bool operator!=(const const_iterator& other) const { return !(*this == other); }
+    };
+
+    SolverRegionsSubset(const std::vector<std::shared_ptr<SolverRegion>>& allRegions,
+                        const BoardGeometry::RegionMask regions)
+        : m_allRegions(allRegions)
+        , m_regions(regions)
+    {}
+
+    const_iterator begin() const { return {m_allRegions.data(), m_regions}; }
+    const_iterator end() const { return {m_allRegions.data(), 0}; }
+
+    BoardGeometry::RegionMask getMask() const { return m_regions; }
+    bool empty() const { return m_regions == 0; }
+
+  private:
+    const std::vector<std::shared_ptr<SolverRegion>>& m_allRegions;
+    BoardGeometry::RegionMask m_regions;
+};
+
 #endif // __SOLVERREGIONS_H__
\ No newline at end of file
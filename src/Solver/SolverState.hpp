@@ -0,0 +1,120 @@
+#ifndef __SOLVERSTATE_H__
+#define __SOLVERSTATE_H__
+
+#include "Board/BoardGeometry.hpp"
+#include "Board/GridState.hpp"
+#include "Suggestions.hpp"
+#include "SuggestionsQuantity.hpp"
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <type_traits>
+
+// Where the suggestions of each value are, line by line: bit col of rows[value - 1][row] is set when the tile
+// (row, col) has the value as a suggestion, and bit row of cols[value - 1][col] likewise. Kept in sync with
+// the suggestions by SolverTile, so the techniques that look at a value across several lines (the fish)
+// work on bit masks
+struct ValuesPositions
+{
+    using LineMask = std::uint16_t;
+    using LinesMasks = std::array<LineMask, 9>;
+
+    std::array<LinesMasks, 9> rows{};
+    std::array<LinesMasks, 9> cols{};
+
+    void add(const BoardGeometry::TileIndex tileIndex, const TileValueType value)
+    {
+        const auto row = BoardGeometry::getRow(tileIndex);
+        const auto col = BoardGeometry::getCol(tileIndex);
+        rows[value - 1][row] |= static_cast<LineMask>(1u << col);
+        cols[value - 1][col] |= static_cast<LineMask>(1u << row);
+    }
+
+    void remove(const BoardGeometry::TileIndex tileIndex, const TileValueType value)
+    {
+        const auto row = BoardGeometry::getRow(tileIndex);
+        const auto col = BoardGeometry::getCol(tileIndex);
+        rows[value - 1][row] &= static_cast<LineMask>(~(1u << col));
+        cols[value - 1][col] &= static_cast<LineMask>(~(1u << row));
+    }
+
+    // tiles with the value as a suggestion
+    TileMask getTiles(const TileValueType value) const
+    {
+        TileMask tiles;
+        for (TileValueType row = 0; row < 9; ++row)
+        {
+            for (auto cols = rows[value - 1][row]; cols != 0; cols &= static_cast<LineMask>(cols - 1))
+            {
+                const auto col = static_cast<TileValueType>(std::countr_zero(cols));
+                tiles.insert(BoardGeometry::toTileIndex(row, col));
+            }
+        }
+        return tiles;
+    }
+
+    bool operator==(const ValuesPositions& other) const = default;
+};
+
+// Tiles with exactly two suggestions (bivalue tiles), grouped by their pair of suggestions. Kept in sync with
+// the suggestions by SolverTile, so the wings find their pivots and pincers by lookup instead of scanning the
+// board
+struct BivalueTiles
+{
+    static constexpr size_t PAIRS_COUNT = 36;
+
+    std::array<TileMask, PAIRS_COUNT> byPair{};
+    TileMask all;
+
+    // index of a pair of values (a 2 suggestions Suggestions) in byPair
+    static constexpr size_t toPairIndex(const Suggestions& pair)
+    {
+        const size_t first = pair.front();
+        const size_t second = pair.back();
+        // pares que começam com valores menores que first, mais a posição de second entre os seus
+        return (first - 1) * 9 - (first - 1) * first / 2 + (second - first - 1);
+    }
+
+    const TileMask& getTiles(const Suggestions& pair) const { return byPair[toPairIndex(pair)]; }
+
+    // moves the tile to the group of its new suggestions when it enters or leaves the bivalue tiles
+    void update(const BoardGeometry::TileIndex tileIndex, const Suggestions& before, const Suggestions& after)
+    {
+        if (before.size() == 2)
+        {
+            byPair[toPairIndex(before)].erase(tileIndex);
+            all.erase(tileIndex);
+        }
+        if (after.size() == 2)
+        {
+            byPair[toPairIndex(after)].insert(tileIndex);
+            all.insert(tileIndex);
+        }
+    }
+
+    bool operator==(const BivalueTiles& other) const = default;
+};
+
+// Suggestions of every tile and suggestion counters of every region of a Solver, indexed as described
+// in BoardGeometry. SolverTiles and SolverRegions only read and write their suggestions here.
+struct SuggestionsState
+{
+    std::array<Suggestions, BoardGeometry::TILES_COUNT> tilesSuggestions{};
+    std::array<SuggestionsQuantity, BoardGeometry::REGIONS_COUNT> regionsSuggestionsQuan{};
+    ValuesPositions valuesPositions{};
+    BivalueTiles bivalueTiles{};
+};
+
+// Complete snapshot of a Solver board. Saving or restoring it is a plain copy, with no allocation.
+struct SolverState
+{
+    GridState grid;
+    SuggestionsState suggestions;
+    bool initializedWithSuggestions{false};
+};
+
+static_assert(std::is_trivially_copyable_v<SuggestionsState>);
+static_assert(std::is_trivially_copyable_v<SolverState>);
+
+#endif // __SOLVERSTATE_H__
@@ -1,6 +1,10 @@
 #include "SolverTile.hpp"
 
+#include "ChangeTracker.hpp"
+#include "SinglesQueue.hpp"
 #include "Solver.hpp"
+#include "SolverState.hpp"
+#include "SolverTrail.hpp"
 
 SolverTile::SolverTile(Grid* grid, TileValueType row, TileValueType col)
     : SolverTile(grid, Coordinates{row, col})
@@ -10,42 +14,115 @@ SolverTile::SolverTile(Grid* grid, const Coordinates& coordinates, TileValueType
     : Tile(grid, coordinates, value)
 {}
 
-SolverTile::SolverTile(const SolverTile& other, Grid* grid)
-    : Tile(other, grid)
+void SolverTile::recordChange()
 {
-    m_suggestions = other.m_suggestions;
+    if (m_trail != nullptr && m_trail->isRecording())
+    {
+        m_trail->record(getIndex(), getValue(), *m_suggestions);
+    }
+    if (m_changeTracker != nullptr)
+    {
+        m_changeTracker->markTileChanged(getIndex());
+    }
+}
+
+void SolverTile::queueSingles(const TileValueType removedValue,
+                              const std::array<SolverRegion*, 3>& solverRegions)
+{
+    if (m_singlesQueue == nullptr)
+    {
+        return;
+    }
+    if (!hasValue() && m_suggestions->size() == 1)
+    {
+        m_singlesQueue->pushNakedSingle(getIndex());
+    }
+    const auto& regionIndexes = BoardGeometry::TILE_REGIONS[getIndex()];
+    for (size_t i = 0; i < solverRegions.size(); ++i)
+    {
+        if (solverRegions[i]->getSuggestionsQuan().getSuggestionsQuantityFor(removedValue) == 1)
+        {
+            m_singlesQueue->pushHiddenSingle(regionIndexes[i], removedValue);
+        }
+    }
+}
+
+void SolverTile::suggestionAddedToPositions(const TileValueType value)
+{
+    if (m_valuesPositions != nullptr)
+    {
+        m_valuesPositions->add(getIndex(), value);
+    }
+}
+
+void SolverTile::suggestionRemovedFromPositions(const TileValueType value)
+{
+    if (m_valuesPositions != nullptr)
+    {
+        m_valuesPositions->remove(getIndex(), value);
+    }
+}
+
+void SolverTile::suggestionsChanged(const Suggestions& before)
+{
+    if (m_bivalueTiles != nullptr)
+    {
+        m_bivalueTiles->update(getIndex(), before, *m_suggestions);
+    }
+}
+
+void SolverTile::restore(TileValueType value, const Suggestions& suggestions)
+{
+    if (m_changeTracker != nullptr)
+    {
+        m_changeTracker->markTileChanged(getIndex());
+    }
+    Tile::setValue(value);
+
+    const auto solverRegions = getSolverRegions();
+    for (const auto suggestion : suggestions - *m_suggestions)
+    {
+        for (auto* solverRegion : solverRegions) { solverRegion->suggestionAdded(suggestion); }
+        suggestionAddedToPositions(suggestion);
+    }
+    for (const auto suggestion : *m_suggestions - suggestions)
+    {
+        for (auto* solverRegion : solverRegions) { solverRegion->suggestionRemoved(suggestion); }
+        suggestionRemovedFromPositions(suggestion);
+    }
+    const auto before = *m_suggestions;
+    *m_suggestions = suggestions;
+    suggestionsChanged(before);
 }
 
 void SolverTile::setValue(TileValueType value)
 {
+    recordChange();
     Tile::setValue(value);
     // removera todas as sugestoes desse tile. Com isso, também é necessario decrementar
     // o número de sugestoes para cada valor contido nas sugestoes em cada region, depois
     // limpando as sugestoes
-    const auto& regions = getRegions();
-    for (const auto& suggestion : m_suggestions)
+    const auto solverRegions = getSolverRegions();
+    for (const auto suggestion : *m_suggestions)
     {
-        // iterate over all regions and cast each region to a SolverRegion
-        for (const auto& region : regions)
-        {
-            auto solverRegion = dynamic_cast<SolverRegion*>(region);
-            solverRegion->suggestionRemoved(suggestion);
-        }
+        for (auto* solverRegion : solverRegions) { solverRegion->suggestionRemoved(suggestion); }
+        suggestionRemovedFromPositions(suggestion);
+        queueSingles(suggestion, solverRegions);
     }
     // remove todas as sugestões
-    m_suggestions.clear();
+    const auto before = *m_suggestions;
+    m_suggestions->clear();
+    suggestionsChanged(before);
 
     // TODO: talvez não passar novamente por tiles já visitados
     // para cada region do tile a ter o valor inserido, remove todas as ocorrência de suggestion
     // desse valor (já que agora ele existe no tile atual)
-    for (auto region : regions)
+    for (auto* region : solverRegions)
     {
         // para cada tile da region a ser iterada
         // não passara pelo tile que está sendo setado porque agora ele contem um valor.
-        for (const auto& tile : *region)
+        for (const auto& solverTile : region->getSolverTiles())
         {
-            // cast tile to SolverTilePtr
-            auto solverTile = std::dynamic_pointer_cast<SolverTile>(tile);
             if (solverTile->hasValue())
                 continue;
 
@@ -59,7 +136,8 @@ void SolverTile::computeSuggestions(const bool clear)
     auto& [hLine, vLine, sGrid] = getRegionsTuple();
     if (clear)
     {
-        m_suggestions.clear();
+        // pelo caminho normal de remoção, para manter as regions, os índices, o trail e a fila de singles
+        removeSuggestions(getSuggestions());
     }
 
     for (TileValueType value = 1; value <= 9; ++value)
@@ -80,13 +158,13 @@ bool SolverTile::canPlaceValueInTile(const TileValueType value, const bool force
     }
     else
     {
-        return m_suggestions.find(value) == m_suggestions.cend();
+        return !m_suggestions->contains(value);
     }
 }
 
 bool SolverTile::hasSuggestion(TileValueType value) const
 {
-    return m_suggestions.find(value) != m_suggestions.cend();
+    return m_suggestions->contains(value);
 }
 
 void SolverTile::addSuggestion(TileValueType value)
@@ -99,77 +177,79 @@ void SolverTile::addSuggestion(TileValueType value)
         throw std::runtime_error(
             fmt::format("Can't add suggestion {} to tile {} because it's already in a region", value, *this));
     }
-    const auto insertedPair = m_suggestions.insert(value);
     // se tiver inserido, então incrementa em 1 o número de ocorrências dessa sugestão em todas
     // as regions desse tile
-    if (insertedPair.second)
+    if (!m_suggestions->contains(value))
+    {
+        recordChange();
+    }
+    const auto before = *m_suggestions;
+    if (m_suggestions->insert(value))
     {
         const auto solverRegions = getSolverRegions();
-        for (const auto& solverRegion : solverRegions) { solverRegion->suggestionAdded(value); }
+        for (auto* solverRegion : solverRegions) { solverRegion->suggestionAdded(value); }
+        suggestionAddedToPositions(value);
+        suggestionsChanged(before);
     }
 }
 
 bool SolverTile::removeSuggestion(TileValueType value)
 {
-    const auto erased = m_suggestions.erase(value);
+    if (m_suggestions->contains(value))
+    {
+        recordChange();
+    }
+    const auto before = *m_suggestions;
+    const auto erased = m_suggestions->erase(value);
     // se tiver apagado (o tile tinha suggestion desse value), diminui o numero de
     // suggestions das SolverRegions desse valor
     if (erased)
     {
-        const auto& regions = getRegions();
-        for (auto& region : regions)
-        {
-            auto* solverRegion = dynamic_cast<SolverRegion*>(region);
-            solverRegion->suggestionRemoved(value);
-        }
+        const auto solverRegions = getSolverRegions();
+        for (auto* solverRegion : solverRegions) { solverRegion->suggestionRemoved(value); }
+        suggestionRemovedFromPositions(value);
+        suggestionsChanged(before);
+        queueSingles(value, solverRegions);
     }
     return erased;
 }
 
-bool SolverTile::removeSuggestions(const std::vector<TileValueType>& suggestions)
+bool SolverTile::removeSuggestions(const Suggestions& suggestions)
 {
-    bool changed = false;
-    for (const auto& suggestion : suggestions) { changed |= removeSuggestion(suggestion); }
-    return changed;
+    // apenas as sugestões que o tile realmente possui precisam ser removidas
+    const auto suggestionsToRemove = *m_suggestions & suggestions;
+    for (const auto suggestion : suggestionsToRemove) { removeSuggestion(suggestion); }
+    return !suggestionsToRemove.empty();
 }
 
-bool SolverTile::removeAllSuggestionsExceptFrom(const std::vector<TileValueType>& exceptionSuggestions)
+bool SolverTile::removeAllSuggestionsExceptFrom(const Suggestions& exceptionSuggestions)
 {
-    bool removed = false;
-    const auto suggestionsCopy = getSuggestions();
-    for (const auto& suggestion : suggestionsCopy)
-    {
-        if (std::find(exceptionSuggestions.begin(), exceptionSuggestions.end(), suggestion) ==
-            exceptionSuggestions.cend())
-        {
-            removed |= removeSuggestion(suggestion);
-        }
-    }
-
-    return removed;
+    return removeSuggestions(*m_suggestions - exceptionSuggestions);
 }
 
 unsigned short SolverTile::getSuggestionsCount() const
 {
-    return static_cast<unsigned short>(m_suggestions.size());
+    return m_suggestions->size();
 }
 
+// os regions de um SolverTile são sempre criados pelo SolverComponentsContructor. Como Line e Subgrid
+// não são bases virtuais de SolverLine e SolverSubgrid, o static_cast é só um ajuste de ponteiro
 SolverLine* SolverTile::getSolverHorizontalLine() const
 {
-    return dynamic_cast<SolverLine*>(getHorizontalLine());
+    return static_cast<SolverLine*>(getHorizontalLine());
 }
 
 SolverLine* SolverTile::getSolverVerticalLine() const
 {
-    return dynamic_cast<SolverLine*>(getVerticalLine());
+    return static_cast<SolverLine*>(getVerticalLine());
 }
 
 SolverSubgrid* SolverTile::getSolverSubgrid() const
 {
-    return dynamic_cast<SolverSubgrid*>(getSubgrid());
+    return static_cast<SolverSubgrid*>(getSubgrid());
 }
 
-std::vector<SolverRegion*> SolverTile::getSolverRegions() const
+std::array<SolverRegion*, 3> SolverTile::getSolverRegions() const
 {
     return {getSolverHorizontalLine(), getSolverVerticalLine(), getSolverSubgrid()};
 }
@@ -3,47 +3,82 @@
 
 #include "Board/Tile.hpp"
 #include "SolverTypes.hpp"
+#include "Suggestions.hpp"
 #include "Util/GlobalDefinitions.hpp"
 
+#include <array>
 #include <string>
-#include <unordered_set>
-#include <vector>
 
 class Solver;
 class SolverLine;
 class SolverSubgrid;
 class SolverRegion;
-
-using Suggestions = std::unordered_set<TileValueType>;
+class SolverTrail;
+class ChangeTracker;
+class SinglesQueue;
+struct ValuesPositions;
+struct BivalueTiles;
 
 class SolverTile : public Tile
 {
   private:
-    Suggestions m_suggestions;
+    // like the value of a Tile, the suggestions of a SolverTile owned by a Solver are stored in the
+    // SuggestionsState of that Solver
+    Suggestions m_detachedSuggestions;
+    Suggestions* m_suggestions{&m_detachedSuggestions};
+
+    SolverTrail* m_trail{nullptr};
+    ChangeTracker* m_changeTracker{nullptr};
+    SinglesQueue* m_singlesQueue{nullptr};
+    ValuesPositions* m_valuesPositions{nullptr};
+    BivalueTiles* m_bivalueTiles{nullptr};
+
+    // saves the current value and suggestions to the trail, if it is recording, and marks the tile as
+    // changed. Called right before every change
+    void recordChange();
+    // queues this tile and the removed value in its regions if they became singles
+    void queueSingles(TileValueType removedValue, const std::array<SolverRegion*, 3>& solverRegions);
+    // keeps the positions of the values of the Solver, if there is one, in sync with the suggestions
+    void suggestionAddedToPositions(TileValueType value);
+    void suggestionRemovedFromPositions(TileValueType value);
+    // keeps the bivalue tiles of the Solver, if there is one, in sync after the suggestions changed
+    void suggestionsChanged(const Suggestions& before);
 
   public:
     SolverTile(Grid* grid, TileValueType row, TileValueType col);
     SolverTile(Grid* grid, const Coordinates& coordinates, TileValueType value = 0);
-    SolverTile(const SolverTile& other, Grid* grid);
+    SolverTile(const SolverTile& other) = delete;
     ~SolverTile() = default;
 
     void setValue(TileValueType value) override;
 
     void computeSuggestions(bool clear = false);
 
-    const Suggestions& getSuggestions() const { return m_suggestions; };
+    void setSuggestionsStorage(Suggestions* suggestionsStorage) { m_suggestions = suggestionsStorage; }
+    void setTrail(SolverTrail* trail) { m_trail = trail; }
+    void setChangeTracker(ChangeTracker* changeTracker) { m_changeTracker = changeTracker; }
+    void setSinglesQueue(SinglesQueue* singlesQueue) { m_singlesQueue = singlesQueue; }
+    void setValuesPositions(ValuesPositions* valuesPositions) { m_valuesPositions = valuesPositions; }
+    void setBivalueTiles(BivalueTiles* bivalueTiles) { m_bivalueTiles = bivalueTiles; }
+
+    // sets the value and suggestions directly, without propagating to the other tiles and without
+    // recording. The suggestions quantity of the regions is kept in sync and the tile is marked as changed.
+    // Used to undo the trail
+    void restore(TileValueType value, const Suggestions& suggestions);
+
+    const Suggestions& getSuggestions() const { return *m_suggestions; };
     bool hasSuggestion(TileValueType value) const;
     void addSuggestion(TileValueType value);
     bool removeSuggestion(TileValueType value);
-    bool removeSuggestions(const std::vector<TileValueType>& suggestions);
-    bool removeAllSuggestionsExceptFrom(const std::vector<TileValueType>& exceptionSuggestions);
+    bool removeSuggestions(const Suggestions& suggestions);
+    bool removeAllSuggestionsExceptFrom(const Suggestions& exceptionSuggestions);
     unsigned short getSuggestionsCount() const;
 
     SolverLine* getSolverHorizontalLine() const;
     SolverLine* getSolverVerticalLine() const;
     SolverSubgrid* getSolverSubgrid() const;
 
-    std::vector<SolverRegion*> getSolverRegions() const;
+    std::array<SolverRegion*, 3> getSolverRegions() const;
 
     bool canPlaceValueInTile(TileValueType value, bool forceCheck = false) const;
 
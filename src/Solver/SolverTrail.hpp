@@ -0,0 +1,98 @@
+#ifndef __SOLVERTRAIL_H__
+#define __SOLVERTRAIL_H__
+
+#include "Board/BoardGeometry.hpp"
+#include "Suggestions.hpp"
+#include "Util/GlobalDefinitions.hpp"
+
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+// Log of the changes made to the tiles of a Solver while it is recording. Each entry keeps the value and
+// the suggestions a tile had right before being changed, so undoing the log in reverse order restores the
+// board in O(changes), without copying it. The region counters are not logged: restoring the suggestions
+// of a tile replays the difference on the SuggestionsQuantity of its regions.
+//
+// The trail records while there is at least one open checkpoint. Checkpoints can be nested and must be
+// closed in the reverse order they were opened.
+class SolverTrail
+{
+  public:
+    struct Entry
+    {
+        BoardGeometry::TileIndex tileIndex;
+        TileValueType value;
+        Suggestions suggestions;
+    };
+
+    using Checkpoint = size_t;
+
+    // enough for most searches, so the trail doesn't allocate while a board is being solved
+    static constexpr size_t INITIAL_CAPACITY = 1024;
+
+    SolverTrail() { m_entries.reserve(INITIAL_CAPACITY); }
+
+    bool isRecording() const { return !m_openCheckpoints.empty(); }
+
+    void record(const BoardGeometry::TileIndex tileIndex,
+                const TileValueType value,
+                const Suggestions& suggestions)
+    {
+        m_entries.push_back(Entry{tileIndex, value, suggestions});
+    }
+
+    Checkpoint getCheckpoint() const { return m_entries.size(); }
+
+    // starts recording, if it wasn't already, and returns the position to undo to
+    Checkpoint openCheckpoint()
+    {
+        m_openCheckpoints.push_back(getCheckpoint());
+        return m_openCheckpoints.back();
+    }
+
+    // closes the innermost checkpoint, which must be the given one. The entries are kept while there are
+    // outer checkpoints, since those may still be rolled back
+    void closeCheckpoint(const Checkpoint checkpoint)
+    {
+        checkInnermostCheckpoint(checkpoint);
+        m_openCheckpoints.pop_back();
+        if (m_openCheckpoints.empty())
+        {
+            m_entries.clear();
+        }
+    }
+
+    void checkInnermostCheckpoint(const Checkpoint checkpoint) const
+    {
+        if (m_openCheckpoints.empty() || m_openCheckpoints.back() != checkpoint)
+        {
+            throw std::invalid_argument("SolverTrail - not the innermost open checkpoint");
+        }
+    }
+
+    size_t getOpenCheckpointsCount() const { return m_openCheckpoints.size(); }
+
+    const std::vector<Entry>& getEntries() const { return m_entries; }
+
+    // removes and returns the most recent entry
+    Entry pop()
+    {
+        const auto entry = m_entries.back();
+        m_entries.pop_back();
+        return entry;
+    }
+
+    // discards the entries and the open checkpoints
+    void clear()
+    {
+        m_entries.clear();
+        m_openCheckpoints.clear();
+    }
+
+  private:
+    std::vector<Entry> m_entries;
+    std::vector<Checkpoint> m_openCheckpoints;
+};
+
+#endif // __SOLVERTRAIL_H__
@@ -1,12 +1,13 @@
 #include "SolverUtils.hpp"
 
+#include "Board/BoardGeometry.hpp"
+#include "Board/Grid.hpp"
 #include "Board/Line.hpp"
 #include "Board/Region.hpp"
 #include "Board/Subgrid.hpp"
 #include "Board/Tile.hpp"
 #include "Solver/SolverRegions.hpp"
 #include "SolverTile.hpp"
-#include "SuggestionsQuantity.hpp"
 
 #include <cassert>
 
@@ -47,61 +48,41 @@ bool SolverUtils::areTilesInTheSameSubgrid(const Tile& tile1, const Tile& tile2)
 
 bool SolverUtils::areTilesInTheSameRegion(const Tile& tile1, const Tile& tile2)
 {
-    return areTilesInTheSameLine(tile1, tile2, LineOrientation::HORIZONTAL) ||
-           areTilesInTheSameLine(tile1, tile2, LineOrientation::VERTICAL) ||
-           areTilesInTheSameSubgrid(tile1, tile2);
-}
-
-SuggestionsQuantity SolverUtils::collectSuggestionInformation(const SolverTileVec& tiles)
-{
-    SuggestionsQuantity suggestionsQuan;
-    for (const auto& tile : tiles)
-    {
-        const auto& tileSuggestions = tile->getSuggestions();
-        for (const auto& suggestion : tileSuggestions) { suggestionsQuan.addSuggestion(suggestion); }
-    }
-    return suggestionsQuan;
+    return BoardGeometry::PEERS[tile1.getIndex()].contains(tile2.getIndex());
 }
 
 Region* SolverUtils::getTilesCommonRegion(const Tile& tile1, const Tile& tile2)
 {
-    if (!areTilesInTheSameRegion(tile1, tile2))
+    const auto commonRegions = BoardGeometry::COMMON_REGIONS[tile1.getIndex()][tile2.getIndex()];
+    if (commonRegions == 0)
     {
         return nullptr;
     }
-    else if (areTilesInTheSameSubgrid(tile1, tile2))
-    {
-        return tile1.getSubgrid();
-    }
-    else if (areTilesInTheSameLine(tile1, tile2, LineOrientation::HORIZONTAL))
-    {
-        return tile1.getHorizontalLine();
-    }
-    else if (areTilesInTheSameLine(tile1, tile2, LineOrientation::VERTICAL))
-    {
-        return tile1.getVerticalLine();
-    }
-    else
+
+    // prioriza o subgrid, depois as linhas
+    const auto regions = tile1.getRegions();
+    for (const auto position : {2, 0, 1})
     {
-        assert(0);
-        return nullptr;
+        if (commonRegions & (1u << position))
+        {
+            return regions[position];
+        }
     }
+    assert(0);
+    return nullptr;
 }
 
 std::vector<SolverRegion*> SolverUtils::getSolverTilesCommonSolverRegions(const SolverTilePtr& tile1,
                                                                           const SolverTilePtr& tile2)
 {
     std::vector<SolverRegion*> result;
+    const auto commonRegions = BoardGeometry::COMMON_REGIONS[tile1->getIndex()][tile2->getIndex()];
     const auto tile1Regions = tile1->getSolverRegions();
-    const auto tile2Regions = tile2->getSolverRegions();
-    for (const auto& tile1Region : tile1Regions)
+    for (size_t position = 0; position < tile1Regions.size(); ++position)
     {
-        for (const auto& tile2Region : tile2Regions)
+        if (commonRegions & (1u << position))
         {
-            if (tile1Region == tile2Region)
-            {
-                result.emplace_back(tile1Region);
-            }
+            result.emplace_back(tile1Regions[position]);
         }
     }
     return result;
@@ -123,20 +104,28 @@ SolverLine* SolverUtils::getCommonSolverLine(const SolverTilePtr& tile1, const S
     }
 }
 
-SolverTileVec SolverUtils::getSeenTiles(const SolverTilePtr& tile)
+TileMask SolverUtils::toTileMask(const SolverTileVec& tiles)
+{
+    TileMask result;
+    for (const auto& tile : tiles) { result.insert(tile->getIndex()); }
+    return result;
+}
+
+SolverTileVec SolverUtils::getSolverTiles(const Grid& grid, const TileMask& tileMask)
 {
-    std::unordered_set<SolverTilePtr> result;
-    for (const auto& region : tile->getSolverRegions())
+    SolverTileVec result;
+    result.reserve(tileMask.size());
+    for (const auto tileIndex : tileMask)
     {
-        for (const auto& regionTile : region->getSolverTiles())
-        {
-            if (regionTile != tile)
-            {
-                result.emplace(regionTile);
-            }
-        }
+        result.emplace_back(std::static_pointer_cast<SolverTile>(
+            grid(BoardGeometry::getRow(tileIndex), BoardGeometry::getCol(tileIndex))));
     }
-    return {result.begin(), result.end()};
+    return result;
+}
+
+SolverTileVec SolverUtils::getSeenTiles(const SolverTilePtr& tile)
+{
+    return getSolverTiles(*tile->getGrid(), BoardGeometry::PEERS[tile->getIndex()]);
 }
 
 SolverTileVec SolverUtils::getMutuallySeenTiles(const SolverTileVec& tiles)
@@ -145,15 +134,8 @@ SolverTileVec SolverUtils::getMutuallySeenTiles(const SolverTileVec& tiles)
     {
         return {};
     }
-    SolverTileVec result;
-    const auto& referenceTile = *tiles.begin();
-    result = getSeenTiles(referenceTile);
-    for (auto it = tiles.begin() + 1; it != tiles.end(); ++it)
-    {
-        const auto& currentTile = *it;
-        std::erase_if(result, [&](const auto& seenTile) {
-            return (seenTile == currentTile) || !areTilesInTheSameRegion(*seenTile, *currentTile);
-        });
-    }
-    return result;
+    auto seenTiles = TileMask::allTiles();
+    for (const auto& tile : tiles) { seenTiles &= BoardGeometry::PEERS[tile->getIndex()]; }
+    // peers nunca incluem o próprio tile, então os tiles de entrada já estão fora do resultado
+    return getSolverTiles(*tiles.front()->getGrid(), seenTiles);
 }
@@ -1,12 +1,13 @@
 #ifndef __SOLVERUTILS_H__
 #define __SOLVERUTILS_H__
 
+#include "Board/TileMask.hpp"
 #include "SolverTypes.hpp"
 #include "Util/GlobalDefinitions.hpp"
 
+class Grid;
 class Tile;
 class Region;
-class SuggestionsQuantity;
 class SolverTile;
 class SolverRegion;
 class SolverLine;
@@ -26,11 +27,12 @@ std::vector<SolverRegion*> getSolverTilesCommonSolverRegions(const SolverTilePtr
 
 SolverLine* getCommonSolverLine(const SolverTilePtr& tile1, const SolverTilePtr& tile2);
 
+TileMask toTileMask(const SolverTileVec& tiles);
+SolverTileVec getSolverTiles(const Grid& grid, const TileMask& tileMask);
+
 SolverTileVec getSeenTiles(const SolverTilePtr& tile);
 SolverTileVec getMutuallySeenTiles(const SolverTileVec& tiles);
 
-SuggestionsQuantity collectSuggestionInformation(const SolverTileVec& tiles);
-
 template<typename Container, typename Iterator>
 static std::vector<Container> createCombination(const int k, Iterator begin, Iterator end)
 {
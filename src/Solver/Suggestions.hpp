@@ -0,0 +1,165 @@
+#ifndef __SUGGESTIONS_H__
+#define __SUGGESTIONS_H__
+
+#include "Util/GlobalDefinitions.hpp"
+
+#include <bit>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+
+// Set of suggestions (candidate values 1-9) of a tile, stored as a 9-bit mask: bit 0 represents the value
+// 1, bit 8 represents the value 9. Every operation is a handful of bitwise instructions and never allocates.
+class Suggestions
+{
+  public:
+    using MaskType = std::uint16_t;
+
+    static constexpr MaskType ALL_VALUES_MASK = 0x1FF;
+
+    // iterates over the values contained in the set, in ascending order
+    struct const_iterator
+    {
+        using iterator_category = std::forward_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+        using value_type = TileValueType;
+        using pointer = const TileValueType*;
+        using reference = TileValueType;
+
+        constexpr const_iterator() = default;
+        constexpr explicit const_iterator(MaskType remaining)
+            : m_remaining(remaining)
+        {}
+
+        constexpr reference operator*() const
+        {
+            return static_cast<TileValueType>(std::countr_zero(m_remaining) + 1);
+        }
+
+        constexpr const_iterator& operator++()
+        {
+            // clears the lowest set bit
+            m_remaining &= static_cast<MaskType>(m_remaining - 1);
+            return *this;
+        }
+
+        constexpr const_iterator operator++(int)
+        {
+            const_iterator tmp = *this;
+            ++(*this);
+            return tmp;
+        }
+
+        constexpr bool operator==(const const_iterator& r) const { return m_remaining == r.m_remaining; }
+        constexpr bool operator!=(const const_iterator& r) const { return m_remaining != r.m_remaining; }
+
+      private:
+        MaskType m_remaining{0};
+    };
+
+    using iterator = const_iterator;
+
+    constexpr Suggestions() = default;
+    constexpr Suggestions(std::initializer_list<TileValueType> values)
+    {
+        for (const auto value : values) { insert(value); }
+    }
+    template<typename Iterator>
+    constexpr Suggestions(Iterator first, Iterator last)
+    {
+        for (; first != last; ++first) { insert(*first); }
+    }
+
+    static constexpr Suggestions fromMask(const MaskType mask)
+    {
+        Suggestions result;
+        result.m_mask = mask & ALL_VALUES_MASK;
+        return result;
+    }
+    static constexpr Suggestions allValues() { return fromMask(ALL_VALUES_MASK); }
+
+    static constexpr MaskType maskFor(const TileValueType value)
+    {
+        return static_cast<MaskType>(1u << (value - 1));
+    }
+
+    constexpr MaskType getMask() const { return m_mask; }
+
+    constexpr bool contains(const TileValueType value) const { return (m_mask & maskFor(value)) != 0; }
+    constexpr bool containsAll(const Suggestions& other) const
+    {
+        return (m_mask & other.m_mask) == other.m_mask;
+    }
+    constexpr bool intersects(const Suggestions& other) const { return (m_mask & other.m_mask) != 0; }
+
+    // returns true if the value was not present before
+    constexpr bool insert(const TileValueType value)
+    {
+        const auto before = m_mask;
+        m_mask |= maskFor(value);
+        return before != m_mask;
+    }
+
+    // returns true if the value was present before
+    constexpr bool erase(const TileValueType value)
+    {
+        const auto before = m_mask;
+        m_mask &= static_cast<MaskType>(~maskFor(value));
+        return before != m_mask;
+    }
+
+    constexpr void clear() { m_mask = 0; }
+
+    constexpr unsigned short size() const { return static_cast<unsigned short>(std::popcount(m_mask)); }
+    constexpr bool empty() const { return m_mask == 0; }
+
+    // lowest and highest values of the set. Must not be called on an empty set
+    constexpr TileValueType front() const { return static_cast<TileValueType>(std::countr_zero(m_mask) + 1); }
+    constexpr TileValueType back() const
+    {
+        return static_cast<TileValueType>(16 - std::countl_zero(m_mask));
+    }
+
+    constexpr const_iterator begin() const { return const_iterator(m_mask); }
+    constexpr const_iterator end() const { return const_iterator(); }
+    constexpr const_iterator cbegin() const { return begin(); }
+    constexpr const_iterator cend() const { return end(); }
+
+    constexpr bool operator==(const Suggestions& other) const { return m_mask == other.m_mask; }
+    constexpr bool operator!=(const Suggestions& other) const { return m_mask != other.m_mask; }
+
+    constexpr Suggestions operator|(const Suggestions& other) const
+    {
+        return fromMask(m_mask | other.m_mask);
+    }
+    constexpr Suggestions operator&(const Suggestions& other) const
+    {
+        return fromMask(m_mask & other.m_mask);
+    }
+    // set difference: values of this set that are not in the other one
+    constexpr Suggestions operator-(const Suggestions& other) const
+    {
+        return fromMask(m_mask & static_cast<MaskType>(~other.m_mask));
+    }
+
+    constexpr Suggestions& operator|=(const Suggestions& other)
+    {
+        m_mask |= other.m_mask;
+        return *this;
+    }
+    constexpr Suggestions& operator&=(const Suggestions& other)
+    {
+        m_mask &= other.m_mask;
+        return *this;
+    }
+    constexpr Suggestions& operator-=(const Suggestions& other)
+    {
+        m_mask &= static_cast<MaskType>(~other.m_mask);
+        return *this;
+    }
+
+  private:
+    MaskType m_mask{0};
+};
+
+#endif // __SUGGESTIONS_H__
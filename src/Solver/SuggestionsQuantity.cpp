@@ -1,88 +1,95 @@
 #include "SuggestionsQuantity.hpp"
 
-SuggestionsQuantity::SuggestionsQuantity()
-{
-    for (TileValueType i = 1; i <= 9; i++) { m_suggestionsQuan[i] = 0; }
-}
+#include <cassert>
 
-void SuggestionsQuantity::addSuggestion(TileValueType value)
+void SuggestionsQuantity::updateMasksFor(TileValueType value)
 {
-    if (value < 1 || value > 9)
+    const auto quantity = m_suggestionsQuan[value - 1];
+
+    m_validSuggestions.erase(value);
+    m_suggestionsWithQuantity1.erase(value);
+    m_suggestionsWithQuantity2.erase(value);
+
+    if (quantity > 0)
     {
-        throw std::invalid_argument("Value must be between 1 and 9");
+        m_validSuggestions.insert(value);
     }
-    const auto currentValue = m_suggestionsQuan[value];
-    if (currentValue == 9)
+    if (quantity == 1)
     {
-        throw std::out_of_range("Trying to increase suggestions number, but it's already at 9!");
+        m_suggestionsWithQuantity1.insert(value);
+    }
+    else if (quantity == 2)
+    {
+        m_suggestionsWithQuantity2.insert(value);
     }
-    m_suggestionsQuan[value] = currentValue + 1;
+}
+
+void SuggestionsQuantity::addSuggestion(TileValueType value)
+{
+    assert(value >= 1 && value <= 9);
+    assert(m_suggestionsQuan[value - 1] < 9);
+    ++m_suggestionsQuan[value - 1];
+    updateMasksFor(value);
 }
 
 void SuggestionsQuantity::removeSuggestion(TileValueType value)
 {
-    if (value < 1 || value > 9)
-    {
-        throw std::invalid_argument("Value must be between 1 and 9");
-    }
-    const auto currentValue = m_suggestionsQuan[value];
-    if (currentValue == 0)
-    {
-        throw std::out_of_range("Trying to decrease suggestions number, but it's already at 0!");
-    }
-    m_suggestionsQuan[value] = currentValue - 1;
+    assert(value >= 1 && value <= 9);
+    assert(m_suggestionsQuan[value - 1] > 0);
+    --m_suggestionsQuan[value - 1];
+    updateMasksFor(value);
 }
 
 TileValueType SuggestionsQuantity::getSuggestionsQuantityFor(TileValueType value) const
 {
-    if (value < 1 || value > 9)
-    {
-        throw std::out_of_range(
-            "Trying to get suggestions quantity for a value smaller than 1 or greater than 9!");
-    }
-    return m_suggestionsQuan.at(value);
+    assert(value >= 1 && value <= 9);
+    return m_suggestionsQuan[value - 1];
 }
 
-std::vector<TileValueType>
-SuggestionsQuantity::getSuggestionsWithQuantityGreaterThan(TileValueType value) const
+Suggestions SuggestionsQuantity::getSuggestionsWithQuantityGreaterThan(TileValueType value) const
 {
-    std::vector<TileValueType> suggestions;
-    for (const auto& suggestionPair : m_suggestionsQuan)
+    if (value == 0)
     {
-        if (suggestionPair.second > value)
-        {
-            suggestions.push_back(suggestionPair.first);
-        }
+        return m_validSuggestions;
     }
-    return suggestions;
-}
-std::vector<TileValueType>
-SuggestionsQuantity::getSuggestionsWithQuantityLessThan(TileValueType value) const
-{
-    std::vector<TileValueType> suggestions;
-    for (const auto& suggestionPair : m_suggestionsQuan)
+    if (value == 1)
     {
-        if (suggestionPair.second < value)
+        return m_validSuggestions - m_suggestionsWithQuantity1;
+    }
+    if (value == 2)
+    {
+        return m_validSuggestions - m_suggestionsWithQuantity1 - m_suggestionsWithQuantity2;
+    }
+
+    Suggestions suggestions;
+    for (TileValueType suggestion = 1; suggestion <= 9; ++suggestion)
+    {
+        if (m_suggestionsQuan[suggestion - 1] > value)
         {
-            suggestions.push_back(suggestionPair.first);
+            suggestions.insert(suggestion);
         }
     }
     return suggestions;
 }
-std::vector<TileValueType>
-SuggestionsQuantity::getSuggestionsWithQuantityEqualTo(TileValueType value) const
+
+Suggestions SuggestionsQuantity::getSuggestionsWithQuantityLessThan(TileValueType value) const
 {
-    std::vector<TileValueType> suggestions;
-    for (const auto& suggestionPair : m_suggestionsQuan)
+    if (value == 0)
     {
-        if (suggestionPair.second == value)
-        {
-            suggestions.push_back(suggestionPair.first);
-        }
+        return {};
     }
-    return suggestions;
+    return Suggestions::allValues() - getSuggestionsWithQuantityGreaterThan(value - 1);
 }
-std::vector<TileValueType> SuggestionsQuantity::getValidSuggestions() const
+
+Suggestions SuggestionsQuantity::getSuggestionsWithQuantityEqualTo(TileValueType value) const
 {
-    return getSuggestionsWithQuantityGreaterThan(0);
+    switch (value)
+    {
+    case 0: return Suggestions::allValues() - m_validSuggestions;
+    case 1: return m_suggestionsWithQuantity1;
+    case 2: return m_suggestionsWithQuantity2;
+    default:
+        return getSuggestionsWithQuantityGreaterThan(value - 1) -
+               getSuggestionsWithQuantityGreaterThan(value);
+    }
 }
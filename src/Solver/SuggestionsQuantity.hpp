@@ -1,36 +1,37 @@
 #ifndef __SUGGESTIONSQUANTITY_H__
 #define __SUGGESTIONSQUANTITY_H__
 
+#include "Suggestions.hpp"
 #include "Util/GlobalDefinitions.hpp"
 
-#include <unordered_map>
-#include <vector>
+#include <array>
+#include <cstdint>
 
+// Counts how many tiles of a group (usually a region) have each value as a suggestion. Besides the
+// counters, the values whose quantity is 1 or 2 are kept as masks, since those are the ones the
+// techniques ask for on every step.
 class SuggestionsQuantity
 {
   private:
-    std::unordered_map<TileValueType, TileValueType> m_suggestionsQuan;
+    std::array<std::uint8_t, 9> m_suggestionsQuan{};
+
+    Suggestions m_validSuggestions;
+    Suggestions m_suggestionsWithQuantity1;
+    Suggestions m_suggestionsWithQuantity2;
+
+    void updateMasksFor(TileValueType value);
 
   public:
-    SuggestionsQuantity();
+    SuggestionsQuantity() = default;
 
     void addSuggestion(TileValueType value);
     void removeSuggestion(TileValueType value);
     TileValueType getSuggestionsQuantityFor(TileValueType value) const;
 
-    std::vector<TileValueType> getSuggestionsWithQuantityGreaterThan(TileValueType value) const;
-    std::vector<TileValueType> getSuggestionsWithQuantityLessThan(TileValueType value) const;
-    std::vector<TileValueType> getSuggestionsWithQuantityEqualTo(TileValueType value) const;
-    std::vector<TileValueType> getValidSuggestions() const;
-
-  public:
-    using SuggestionsQuan = std::unordered_map<TileValueType, TileValueType>;
-    SuggestionsQuan::iterator begin() { return m_suggestionsQuan.begin(); }
-    SuggestionsQuan::iterator end() { return m_suggestionsQuan.end(); }
-    SuggestionsQuan::const_iterator cbegin() const { return m_suggestionsQuan.cbegin(); }
-    SuggestionsQuan::const_iterator cend() const { return m_suggestionsQuan.cend(); }
-    SuggestionsQuan::const_iterator begin() const { return cbegin(); }
-    SuggestionsQuan::const_iterator end() const { return cend(); }
+    Suggestions getSuggestionsWithQuantityGreaterThan(TileValueType value) const;
+    Suggestions getSuggestionsWithQuantityLessThan(TileValueType value) const;
+    Suggestions getSuggestionsWithQuantityEqualTo(TileValueType value) const;
+    Suggestions getValidSuggestions() const { return m_validSuggestions; }
 };
 
-#endif // __SUGGESTIONSQUANTITY_H__
\ No newline at end of file
+#endif // __SUGGESTIONSQUANTITY_H__
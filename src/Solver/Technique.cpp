@@ -1,2 +1,76 @@
 #include "Technique.hpp"
+#include "Solver.hpp"
 
+void Technique::collectChanges()
+{
+    auto& changeTracker = m_solver.getChangeTracker();
+    m_tilesToScan |= changeTracker.getChangedTilesSince(m_changesStamp);
+    m_regionsToScan |= changeTracker.getChangedRegionsSince(m_changesStamp);
+    // as mudanças feitas a partir daqui serão coletadas na próxima chamada
+    m_changesStamp = changeTracker.advance();
+}
+
+TileMask Technique::getTilesToScan()
+{
+    collectChanges();
+    return m_tilesToScan;
+}
+
+SolverRegionsSubset Technique::getRegionsToScan(const BoardGeometry::RegionMask regions)
+{
+    collectChanges();
+    return SolverRegionsSubset(m_solver.getAllRegions(), m_regionsToScan & regions);
+}
+
+void Technique::markRegionScanned(const SolverRegion& region)
+{
+    const auto regionIndex = BoardGeometry::toRegionIndex(region.getRegionSpecificType(),
+                                                          static_cast<TileValueType>(region.getIndex()));
+    m_regionsToScan &= ~(BoardGeometry::RegionMask{1} << regionIndex);
+}
+
+bool Technique::run()
+{
+    if constexpr (!TECHNIQUE_STATISTICS_ENABLED)
+    {
+        if (!analyze() || !perform())
+        {
+            return false;
+        }
+        ++m_ranCount;
+        return true;
+    }
+    else
+    {
+        using Clock = std::chrono::steady_clock;
+
+        ++m_statistics.analyzeCallsCount;
+        auto begin = Clock::now();
+        const bool shouldProceed = analyze();
+        m_statistics.analyzeTime += Clock::now() - begin;
+        if (!shouldProceed)
+        {
+            return false;
+        }
+        ++m_statistics.analyzePassesCount;
+
+        // contados fora do tempo de perform, e só quando o analyze encontrou algo
+        const auto candidatesBefore = m_solver.getCandidatesCount();
+        const auto valuesBefore = m_solver.getValuesCount();
+
+        begin = Clock::now();
+        const bool performed = perform();
+        m_statistics.performTime += Clock::now() - begin;
+
+        m_statistics.eliminatedCandidatesCount += candidatesBefore - m_solver.getCandidatesCount();
+        m_statistics.placedValuesCount += m_solver.getValuesCount() - valuesBefore;
+        if (!performed)
+        {
+            return false;
+        }
+
+        ++m_statistics.performSuccessesCount;
+        ++m_ranCount;
+        return true;
+    }
+}
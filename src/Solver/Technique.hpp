@@ -1,6 +1,12 @@
 #ifndef __TECHNIQUE_H__
 #define __TECHNIQUE_H__
 
+#include "Board/BoardGeometry.hpp"
+#include "Board/TileMask.hpp"
+#include "ChangeTracker.hpp"
+#include "SolverRegions.hpp"
+#include "TechniqueStatistics.hpp"
+
 #include <string>
 
 class Solver;
@@ -13,6 +19,16 @@ class Technique
     virtual bool analyze() = 0;
     virtual bool perform() = 0;
 
+    // tiles and regions changed since they were last marked as scanned by this technique (all of them
+    // before its first run). A technique that only looks at the suggestions of a region (or a tile) can
+    // skip the ones that didn't change, since they can't have new findings
+    TileMask getTilesToScan();
+    SolverRegionsSubset getRegionsToScan(BoardGeometry::RegionMask regions = BoardGeometry::ALL_REGIONS_MASK);
+
+    void markTilesScanned(const TileMask& tiles) { m_tilesToScan -= tiles; }
+    void markRegionScanned(const SolverRegion& region);
+    void markRegionsScanned(const SolverRegionsSubset& regions) { m_regionsToScan &= ~regions.getMask(); }
+
   public:
     Technique(Solver& solver)
         : m_solver(solver)
@@ -20,32 +36,34 @@ class Technique
     virtual ~Technique() = default;
 
     // TODO: improve return type
-    bool run()
-    {
-        const bool shouldProceed = analyze();
-        if (!shouldProceed)
-        {
-            return false;
-        }
-        const bool performed = perform();
-        if (!performed)
-        {
-            return false;
-        }
-
-        ++m_ranCount;
-        return true;
-    }
+    bool run();
 
     virtual std::string getTechniqueName() const = 0;
+    virtual bool requiresUniqueSolution() const = 0;
+    virtual TechniqueTier getTier() const = 0;
 
     unsigned int getRanCount() const { return m_ranCount; }
 
+    // always empty when TECHNIQUE_STATISTICS_ENABLED is false
+    const TechniqueStatistics& getStatistics() const { return m_statistics; }
+    void resetStatistics()
+    {
+        m_statistics = TechniqueStatistics{};
+        m_ranCount = 0;
+    }
+
   private:
     unsigned int m_ranCount{0};
+
+    ChangeTracker::Stamp m_changesStamp{0};
+    TileMask m_tilesToScan{TileMask::allTiles()};
+    BoardGeometry::RegionMask m_regionsToScan{BoardGeometry::ALL_REGIONS_MASK};
+    void collectChanges();
+
+    TechniqueStatistics m_statistics;
 };
 
-#define NEW_TECHNIQUE(name)                                                                                  \
+#define NEW_TECHNIQUE_IMPL(name, techniqueTier, uniqueSolutionRequired)                                      \
     class name : public Technique                                                                            \
     {                                                                                                        \
       protected:                                                                                             \
@@ -59,6 +77,13 @@ class Technique
         ~name() = default;                                                                                   \
                                                                                                              \
         std::string getTechniqueName() const override { return #name; }                                      \
+        bool requiresUniqueSolution() const override { return uniqueSolutionRequired; }                      \
+        TechniqueTier getTier() const override { return TechniqueTier::techniqueTier; }                      \
     }
 
+#define NEW_TECHNIQUE(name, tier) NEW_TECHNIQUE_IMPL(name, tier, false)
+
+// techniques whose eliminations are only valid for boards with a single solution (uniqueness techniques)
+#define NEW_UNIQUENESS_TECHNIQUE(name) NEW_TECHNIQUE_IMPL(name, ADVANCED, true)
+
 #endif // __TECHNIQUE_H__
\ No newline at end of file
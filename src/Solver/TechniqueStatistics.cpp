@@ -0,0 +1,62 @@
+#include "TechniqueStatistics.hpp"
+
+#include <fmt/format.h>
+
+double TechniqueStatistics::getHitRate() const
+{
+    return analyzeCallsCount > 0 ? static_cast<double>(performSuccessesCount) / analyzeCallsCount : 0.0;
+}
+
+TechniqueStatistics& TechniqueStatistics::operator+=(const TechniqueStatistics& other)
+{
+    analyzeCallsCount += other.analyzeCallsCount;
+    analyzePassesCount += other.analyzePassesCount;
+    performSuccessesCount += other.performSuccessesCount;
+    analyzeTime += other.analyzeTime;
+    performTime += other.performTime;
+    eliminatedCandidatesCount += other.eliminatedCandidatesCount;
+    placedValuesCount += other.placedValuesCount;
+    return *this;
+}
+
+TechniqueStatistics TechniquesReport::getTotal() const
+{
+    TechniqueStatistics total;
+    for (const auto& technique : techniques) { total += technique.statistics; }
+    return total;
+}
+
+std::string TechniquesReport::toString() const
+{
+    std::string result = fmt::format("  {:<22} {:>8} {:>8} {:>8} {:>12} {:>12} {:>10} {:>7}\n",
+                                     "technique",
+                                     "analyze",
+                                     "passed",
+                                     "perform",
+                                     "analyze us",
+                                     "perform us",
+                                     "eliminated",
+                                     "placed");
+
+    const auto toLine = [](const std::string& name, const TechniqueStatistics& statistics) {
+        const auto toMicroseconds = [](const std::chrono::nanoseconds time) {
+            return std::chrono::duration<double, std::micro>(time).count();
+        };
+        return fmt::format("  {:<22} {:>8} {:>8} {:>8} {:>12.1f} {:>12.1f} {:>10} {:>7}\n",
+                           name,
+                           statistics.analyzeCallsCount,
+                           statistics.analyzePassesCount,
+                           statistics.performSuccessesCount,
+                           toMicroseconds(statistics.analyzeTime),
+                           toMicroseconds(statistics.performTime),
+                           statistics.eliminatedCandidatesCount,
+                           statistics.placedValuesCount);
+    };
+
+    for (const auto& technique : techniques)
+    {
+        result += toLine(technique.techniqueName, technique.statistics);
+    }
+    result += toLine("total", getTotal());
+    return result;
+}
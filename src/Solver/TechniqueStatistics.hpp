@@ -0,0 +1,72 @@
+#ifndef __TECHNIQUESTATISTICS_H__
+#define __TECHNIQUESTATISTICS_H__
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// The counters of Technique::run are compiled out when SOLVER_DISABLE_TECHNIQUE_STATISTICS is defined
+// (see the SOLVER_TECHNIQUE_STATISTICS option of the Solver library)
+#ifdef SOLVER_DISABLE_TECHNIQUE_STATISTICS
+inline constexpr bool TECHNIQUE_STATISTICS_ENABLED = false;
+#else
+inline constexpr bool TECHNIQUE_STATISTICS_ENABLED = true;
+#endif
+
+// How hard a technique is for a person, in increasing order. Each game difficulty accepts the tiers up to
+// its own
+enum class TechniqueTier
+{
+    NONE = 0,
+    // a value that is the only suggestion of its tile
+    BASIC,
+    // a value that fits in a single tile of a region
+    EASY,
+    // intersections and subsets
+    INTERMEDIATE,
+    // fish, wings, chains, uniqueness and the search
+    ADVANCED
+};
+
+// What a technique did since the board was loaded
+struct TechniqueStatistics
+{
+    size_t analyzeCallsCount{0};
+    // analyze calls that did not bail out, so perform was called. Not comparable between techniques: some
+    // search in analyze, others (Fish, the wings, Medusa3D) only check there whether the board changed
+    size_t analyzePassesCount{0};
+    // perform calls that changed the board
+    size_t performSuccessesCount{0};
+    std::chrono::nanoseconds analyzeTime{0};
+    std::chrono::nanoseconds performTime{0};
+    // candidates removed from the board, including the ones of the tiles that received a value
+    size_t eliminatedCandidatesCount{0};
+    size_t placedValuesCount{0};
+
+    // fraction of the analyze calls that ended with a change to the board
+    double getHitRate() const;
+
+    TechniqueStatistics& operator+=(const TechniqueStatistics& other);
+};
+
+struct TechniqueReport
+{
+    std::string techniqueName;
+    TechniqueTier tier{TechniqueTier::NONE};
+    TechniqueStatistics statistics;
+    // times the technique changed the board. Counted even when TECHNIQUE_STATISTICS_ENABLED is false
+    unsigned int ranCount{0};
+};
+
+// Statistics of every technique of a Solver, in the order they are tried
+struct TechniquesReport
+{
+    std::vector<TechniqueReport> techniques;
+
+    TechniqueStatistics getTotal() const;
+    // one line per technique, as printed by Solver::solve
+    std::string toString() const;
+};
+
+#endif // __TECHNIQUESTATISTICS_H__
@@ -0,0 +1,50 @@
+#include "BoxLineReduction.hpp"
+
+#include "Solver/Solver.hpp"
+#include "Tools/IntersectionFinder.hpp"
+
+bool BoxLineReduction::analyze()
+{
+    const auto linesToScan = getRegionsToScan(BoardGeometry::LINES_MASK);
+    for (const auto& line : linesToScan)
+    {
+        // só um valor com 2 ou 3 sugestões na linha pode estar todo num mesmo subgrid
+        const auto& suggestionsQuan = line->getSuggestionsQuan();
+        const auto suggestionsWith2Or3Appearances = suggestionsQuan.getSuggestionsWithQuantityGreaterThan(1) &
+                                                    suggestionsQuan.getSuggestionsWithQuantityLessThan(4);
+        if (!suggestionsWith2Or3Appearances.empty())
+        {
+            return true;
+        }
+    }
+    markRegionsScanned(linesToScan);
+    return false;
+}
+
+bool BoxLineReduction::perform()
+{
+    bool performed = false;
+    // as eliminações só dependem da linha: o subgrid alvo só pode perder sugestões
+    const auto linesToScan = getRegionsToScan(BoardGeometry::LINES_MASK);
+    IntersectionFinder finder(m_solver.getValuesPositions());
+    for (const auto& line : linesToScan)
+    {
+        const auto orientation = line->getRegionSpecificType() == RegionSpecificType::HORIZONTAL_LINE
+                                     ? LineOrientation::HORIZONTAL
+                                     : LineOrientation::VERTICAL;
+        const auto lineIndex = static_cast<TileValueType>(line->getIndex());
+        while (const auto claiming = finder.findClaiming(orientation, lineIndex))
+        {
+            if (!applyLockedCandidates(m_solver, *claiming))
+            {
+                break;
+            }
+            performed = true;
+            // os segmentos só mudam quando alguma sugestão foi removida
+            finder = IntersectionFinder(m_solver.getValuesPositions());
+        }
+    }
+    markRegionsScanned(linesToScan);
+
+    return performed;
+}
@@ -0,0 +1,8 @@
+#ifndef __BOXLINEREDUCTION_H__
+#define __BOXLINEREDUCTION_H__
+
+#include "Solver/Technique.hpp"
+
+NEW_TECHNIQUE(BoxLineReduction, INTERMEDIATE);
+
+#endif // __BOXLINEREDUCTION_H__
\ No newline at end of file
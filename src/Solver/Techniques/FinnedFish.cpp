@@ -0,0 +1,25 @@
+#include "FinnedFish.hpp"
+
+#include "Solver/Solver.hpp"
+#include "Tools/FishFinder.hpp"
+
+bool FinnedFish::analyze()
+{
+    // como o Fish, olha todas as linhas de uma vez
+    return !getTilesToScan().empty();
+}
+
+bool FinnedFish::perform()
+{
+    const FishFinder finder(m_solver.getValuesPositions());
+    for (auto size = FishFinder::MIN_SIZE; size <= FishFinder::MAX_SIZE; ++size)
+    {
+        if (const auto fish = finder.findFish(size, /*finned=*/true))
+        {
+            applyFish(m_solver, *fish);
+            return true;
+        }
+    }
+    markTilesScanned(TileMask::allTiles());
+    return false;
+}
@@ -0,0 +1,8 @@
+#ifndef __FINNEDFISH_H__
+#define __FINNEDFISH_H__
+
+#include "Solver/Technique.hpp"
+
+NEW_TECHNIQUE(FinnedFish, ADVANCED);
+
+#endif // __FINNEDFISH_H__
@@ -0,0 +1,25 @@
+#include "Fish.hpp"
+
+#include "Solver/Solver.hpp"
+#include "Tools/FishFinder.hpp"
+
+bool Fish::analyze()
+{
+    // o fish olha todas as linhas de uma vez, então só precisa procurar de novo se algum tile mudou
+    return !getTilesToScan().empty();
+}
+
+bool Fish::perform()
+{
+    const FishFinder finder(m_solver.getValuesPositions());
+    for (auto size = FishFinder::MIN_SIZE; size <= FishFinder::MAX_SIZE; ++size)
+    {
+        if (const auto fish = finder.findFish(size, /*finned=*/false))
+        {
+            applyFish(m_solver, *fish);
+            return true;
+        }
+    }
+    markTilesScanned(TileMask::allTiles());
+    return false;
+}
@@ -0,0 +1,8 @@
+#ifndef __FISH_H__
+#define __FISH_H__
+
+#include "Solver/Technique.hpp"
+
+NEW_TECHNIQUE(Fish, ADVANCED);
+
+#endif // __FISH_H__
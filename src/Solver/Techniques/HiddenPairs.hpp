@@ -1,8 +0,0 @@
-#ifndef __HIDDENPAIRS_H__
-#define __HIDDENPAIRS_H__
-
-#include "Solver/Technique.hpp"
-
-NEW_TECHNIQUE(HiddenPairs);
-
-#endif // __HIDDENPAIRS_H__
\ No newline at end of file
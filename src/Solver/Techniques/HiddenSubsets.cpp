@@ -0,0 +1,73 @@
+#include "HiddenSubsets.hpp"
+
+#include "Solver/Solver.hpp"
+#include "Solver/SolverTile.hpp"
+#include "Tools/SubsetFinder.hpp"
+#include "Util/UtilFunctions.hpp"
+
+#include <fmt/format.h>
+
+bool HiddenSubsets::analyze()
+{
+    const auto regionsToScan = getRegionsToScan();
+    for (const auto& region : regionsToScan)
+    {
+        // precisa de pelo menos 2 sugestões que aparecem em no máximo MAX_SIZE tiles (e em mais de 1)
+        const auto& suggestionsQuan = region->getSuggestionsQuan();
+        const auto candidateSuggestions =
+            suggestionsQuan.getSuggestionsWithQuantityGreaterThan(1) &
+            suggestionsQuan.getSuggestionsWithQuantityLessThan(SubsetFinder::MAX_SIZE + 1);
+        if (candidateSuggestions.size() >= SubsetFinder::MIN_SIZE)
+        {
+            return true;
+        }
+    }
+    markRegionsScanned(regionsToScan);
+    return false;
+}
+
+bool HiddenSubsets::perform()
+{
+    bool performed = false;
+    const auto regionsToScan = getRegionsToScan();
+    for (const auto& region : regionsToScan)
+    {
+        const SubsetFinder finder(*region);
+        for (auto size = SubsetFinder::MIN_SIZE; size <= SubsetFinder::MAX_SIZE; ++size)
+        {
+            const auto subset = finder.findHiddenSubset(size);
+            if (!subset.has_value())
+            {
+                continue;
+            }
+
+            SolverTileVec subsetTiles;
+            const auto& solverTiles = region->getSolverTiles();
+            for (unsigned int position = 0; position < solverTiles.size(); ++position)
+            {
+                if ((subset->tiles & (1u << position)) != 0)
+                {
+                    solverTiles[position]->removeAllSuggestionsExceptFrom(subset->values);
+                    subsetTiles.emplace_back(solverTiles[position]);
+                }
+            }
+            performed = true;
+
+            m_solver.report("Hidden {}:\nA região {} possui {} tiles, {}, que são os únicos em que as "
+                            "sugestões {} aparecem. Dessa forma, esses valores precisam ser a solução "
+                            "desses tiles, e todas as outras sugestões deles foram removidas.",
+                            subset->getSizeName(),
+                            *region,
+                            subset->getSize(),
+                            fmt::join(subsetTiles, ", "),
+                            joinContainer(subset->values, ", "));
+
+            // as remoções mudam as sugestões lidas pelo finder: a região é vista de novo
+            // na próxima execução
+            break;
+        }
+    }
+    markRegionsScanned(regionsToScan);
+
+    return performed;
+}
@@ -0,0 +1,8 @@
+#ifndef __HIDDENSUBSETS_H__
+#define __HIDDENSUBSETS_H__
+
+#include "Solver/Technique.hpp"
+
+NEW_TECHNIQUE(HiddenSubsets, INTERMEDIATE);
+
+#endif // __HIDDENSUBSETS_H__
@@ -201,12 +201,10 @@ class HiddenUniqueRectanglesAnalyzer
 
 bool HiddenUniqueRectangles::analyze()
 {
-    std::unordered_map<TileValueType, int> suggestionsPerValue;
     for (const auto& vLine : m_solver.getAllSolverVerticalLines())
     {
         const auto& suggestionsQuan = vLine->getSuggestionsQuan();
-        const auto& candidateSuggestions = suggestionsQuan.getSuggestionsWithQuantityGreaterThan(1);
-        if (candidateSuggestions.size() >= 2)
+        if (suggestionsQuan.getSuggestionsWithQuantityGreaterThan(1).size() >= 2)
         {
             return true;
         }
@@ -225,7 +223,8 @@ bool HiddenUniqueRectangles::perform()
             continue;
         }
 
-        const auto combinations = SolverUtils::createCombination(2, candidateSuggestions);
+        const auto combinations = SolverUtils::createCombination(
+            2, std::vector<TileValueType>(candidateSuggestions.begin(), candidateSuggestions.end()));
         for (const auto& combination : combinations)
         {
             // we must also check if there are at least 2 tiles with 2 suggestions to constitute the
@@ -3,6 +3,6 @@
 
 #include "Solver/Technique.hpp"
 
-NEW_TECHNIQUE(HiddenUniqueRectangles);
+NEW_UNIQUENESS_TECHNIQUE(HiddenUniqueRectangles);
 
 #endif // __HIDDENUNIQUERETANGLES_H__
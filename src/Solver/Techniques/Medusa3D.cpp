@@ -0,0 +1,69 @@
+#include "Medusa3D.hpp"
+
+#include "Solver/Solver.hpp"
+#include "Solver/SolverTile.hpp"
+#include "Tools/MedusaColoring.hpp"
+
+#include <fmt/format.h>
+
+#include <string>
+#include <vector>
+
+namespace
+{
+std::string describeRule(const MedusaFinding::Rule rule)
+{
+    switch (rule)
+    {
+    case MedusaFinding::Rule::COLOR_TWICE_IN_TILE:
+        return "uma das cores aparece duas vezes no mesmo tile, então ela é falsa e todas as suas sugestões "
+               "foram removidas";
+    case MedusaFinding::Rule::COLOR_TWICE_IN_REGION:
+        return "uma das cores aparece duas vezes com o mesmo valor numa região, então ela é falsa e todas as "
+               "suas sugestões foram removidas";
+    case MedusaFinding::Rule::TWO_COLORS_IN_TILE:
+        return "um tile tem sugestões das duas cores, então uma delas é a sua solução e as outras sugestões "
+               "foram removidas";
+    case MedusaFinding::Rule::TWO_COLORS_ELSEWHERE:
+        return "as sugestões removidas veem o mesmo valor com as duas cores";
+    case MedusaFinding::Rule::TWO_COLORS_UNIT_AND_TILE:
+        return "as sugestões removidas estão em tiles com uma das cores e veem o mesmo valor com a outra";
+    }
+    return "";
+}
+} // namespace
+
+bool Medusa3D::analyze()
+{
+    // o grafo cobre todo o tabuleiro, então só precisa ser montado de novo se algum tile mudou
+    return !getTilesToScan().empty();
+}
+
+bool Medusa3D::perform()
+{
+    const auto finding = MedusaColoring(m_solver).findEliminations();
+    if (!finding.has_value())
+    {
+        markTilesScanned(TileMask::allTiles());
+        return false;
+    }
+
+    std::vector<std::string> removed;
+    for (TileValueType value = 1; value <= 9; ++value)
+    {
+        for (const auto tileIndex : finding->eliminations[value - 1])
+        {
+            const auto& tile = m_solver(BoardGeometry::toCoordinates(tileIndex));
+            tile->removeSuggestion(value);
+            removed.emplace_back(fmt::format("{} ({})", tile, value));
+        }
+    }
+
+    m_solver.report("3D Medusa:\nAs sugestões ligadas por tiles com duas sugestões e por valores que só "
+                    "aparecem duas vezes numa região foram pintadas com duas cores, das quais apenas uma é "
+                    "verdadeira. Num grupo de {} sugestões, {}: {}.",
+                    finding->clusterSize,
+                    describeRule(finding->rule),
+                    fmt::join(removed, ", "));
+    return true;
+}
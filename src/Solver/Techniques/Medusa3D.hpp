@@ -0,0 +1,8 @@
+#ifndef __MEDUSA3D_H__
+#define __MEDUSA3D_H__
+
+#include "Solver/Technique.hpp"
+
+NEW_TECHNIQUE(Medusa3D, ADVANCED);
+
+#endif // __MEDUSA3D_H__
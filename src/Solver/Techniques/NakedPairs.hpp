@@ -1,8 +0,0 @@
-#ifndef __NAKEDPAIRS_H__
-#define __NAKEDPAIRS_H__
-
-#include "Solver/Technique.hpp"
-
-NEW_TECHNIQUE(NakedPairs);
-
-#endif // __NAKEDPAIRS_H__
\ No newline at end of file
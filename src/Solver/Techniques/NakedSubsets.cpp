@@ -0,0 +1,82 @@
+#include "NakedSubsets.hpp"
+
+#include "Solver/Solver.hpp"
+#include "Solver/SolverTile.hpp"
+#include "Tools/SubsetFinder.hpp"
+#include "Util/UtilFunctions.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+
+bool NakedSubsets::analyze()
+{
+    const auto regionsToScan = getRegionsToScan();
+    for (const auto& region : regionsToScan)
+    {
+        // o subset precisa de pelo menos um tile fora dele de onde remover as sugestões
+        const auto& solverTiles = region->getSolverTiles();
+        const auto tilesWithSuggestionsCount =
+            std::count_if(solverTiles.begin(), solverTiles.end(), [](const SolverTilePtr& solverTile) {
+                return solverTile->getSuggestionsCount() >= 2;
+            });
+        if (tilesWithSuggestionsCount > static_cast<long>(SubsetFinder::MIN_SIZE))
+        {
+            return true;
+        }
+    }
+    markRegionsScanned(regionsToScan);
+    return false;
+}
+
+bool NakedSubsets::perform()
+{
+    bool performed = false;
+    const auto regionsToScan = getRegionsToScan();
+    for (const auto& region : regionsToScan)
+    {
+        const SubsetFinder finder(*region);
+        for (auto size = SubsetFinder::MIN_SIZE; size <= SubsetFinder::MAX_SIZE; ++size)
+        {
+            const auto subset = finder.findNakedSubset(size);
+            if (!subset.has_value())
+            {
+                continue;
+            }
+
+            SolverTileVec subsetTiles;
+            SolverTileVec removedFrom;
+            const auto& solverTiles = region->getSolverTiles();
+            for (unsigned int position = 0; position < solverTiles.size(); ++position)
+            {
+                const auto& solverTile = solverTiles[position];
+                if ((subset->tiles & (1u << position)) != 0)
+                {
+                    subsetTiles.emplace_back(solverTile);
+                }
+                else if (solverTile->removeSuggestions(subset->values))
+                {
+                    removedFrom.emplace_back(solverTile);
+                }
+            }
+            performed = true;
+
+            m_solver.report("Naked {}:\nA região \"{}\" possui {} tiles, {}, cujas sugestões são apenas "
+                            "{}. Dessa forma, esses valores precisam ser a solução desses tiles, e as "
+                            "sugestões foram removidas dos outros tiles da região: {}.",
+                            subset->getSizeName(),
+                            *region,
+                            subset->getSize(),
+                            fmt::join(subsetTiles, ", "),
+                            joinContainer(subset->values, ", "),
+                            fmt::join(removedFrom, ", "));
+
+            // as remoções mudam as sugestões lidas pelo finder: a região é vista de novo
+            // na próxima execução
+            break;
+        }
+    }
+    markRegionsScanned(regionsToScan);
+
+    return performed;
+}
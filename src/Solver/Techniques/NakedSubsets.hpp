@@ -0,0 +1,8 @@
+#ifndef __NAKEDSUBSETS_H__
+#define __NAKEDSUBSETS_H__
+
+#include "Solver/Technique.hpp"
+
+NEW_TECHNIQUE(NakedSubsets, INTERMEDIATE);
+
+#endif // __NAKEDSUBSETS_H__
@@ -1,8 +0,0 @@
-#ifndef __NAKEDTRIPLES_H__
-#define __NAKEDTRIPLES_H__
-
-#include "Solver/Technique.hpp"
-
-NEW_TECHNIQUE(NakedTriples);
-
-#endif // __NAKEDTRIPLES_H__
\ No newline at end of file
@@ -3,6 +3,6 @@
 
 #include "Solver/Technique.hpp"
 
-NEW_TECHNIQUE(PointingPair);
+NEW_TECHNIQUE(PointingPair, INTERMEDIATE);
 
 #endif // __POINTINGPAIR_H__
\ No newline at end of file
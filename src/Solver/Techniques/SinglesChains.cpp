@@ -390,7 +390,7 @@ class SinglesChainsAnalyzer
                 Traversal::getExtremityElementFrom(rootElement);
             for (const auto& tile : m_solver.getGridTiles())
             {
-                const auto solverTile = std::dynamic_pointer_cast<SolverTile>(tile);
+                const auto solverTile = std::static_pointer_cast<SolverTile>(tile);
                 if (!solverTile->hasSuggestion(chainedValue))
                     continue;
 
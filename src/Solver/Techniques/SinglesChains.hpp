@@ -3,6 +3,6 @@
 
 #include "Solver/Technique.hpp"
 
-NEW_TECHNIQUE(SinglesChains);
+NEW_TECHNIQUE(SinglesChains, ADVANCED);
 
 #endif // __SINGLESCHAINS_H__
\ No newline at end of file
@@ -9,40 +9,38 @@
 
 bool SinglesRegion::analyze()
 {
-    return true;
+    return m_solver.getSinglesQueue().hasHiddenSingles();
 }
 
 bool SinglesRegion::perform()
 {
     bool performed = false;
-    for (auto&& region : m_solver.getAllRegions())
+    auto& singlesQueue = m_solver.getSinglesQueue();
+    while (singlesQueue.hasHiddenSingles())
     {
-        const SuggestionsQuantity& suggestionNum = region->getSuggestionsQuan();
-        // procura na region, entre os numero de sugestões para cada valor,
-        // se há algum com apenas 1 (single)
-        // SuggestionsQuan -> 1st: value (suggestion), 2nd: quantity
-        auto found = std::find_if(suggestionNum.cbegin(), suggestionNum.cend(), [](const auto& in) -> bool {
-            return in.second == 1;
-        });
-        if (found != suggestionNum.cend())
+        const auto hiddenSingle = singlesQueue.popHiddenSingle();
+        const auto& region = m_solver.getAllRegions()[hiddenSingle.first];
+        const TileValueType value = hiddenSingle.second;
+        // a region pode ter perdido a última sugestão desse valor depois de entrar na fila
+        if (region->getSuggestionsQuan().getSuggestionsQuantityFor(value) != 1)
         {
-            // a key desse iterator será o valor que tem apenas 1 sugestão
-            const TileValueType value = found->first;
-            // sempre vai achar
-            auto foundTile = std::find_if(region->cbegin(), region->cend(), [&](auto& in) -> bool {
-                return std::dynamic_pointer_cast<SolverTile>(in)->hasSuggestion(value);
-            });
-            assert(foundTile != region->cend());
-            auto solverTile = std::dynamic_pointer_cast<SolverTile>(*foundTile);
-            solverTile->setValue(value);
-            performed = true;
-
-            m_solver.report("Singles-Region:\nA região \"{}\" apresenta somente 1 sugestão do "
-                            "valor {}, no Tile {}. Dessa forma, esse Tile foi definido com esse valor.",
-                            *region,
-                            value,
-                            **foundTile);
+            continue;
         }
+
+        // sempre vai achar
+        const auto& solverTiles = region->getSolverTiles();
+        const auto foundTile = std::find_if(solverTiles.begin(), solverTiles.end(), [&](const auto& in) {
+            return in->hasSuggestion(value);
+        });
+        assert(foundTile != solverTiles.end());
+        (*foundTile)->setValue(value);
+        performed = true;
+
+        m_solver.report("Singles-Region:\nA região \"{}\" apresenta somente 1 sugestão do "
+                        "valor {}, no Tile {}. Dessa forma, esse Tile foi definido com esse valor.",
+                        *region,
+                        value,
+                        **foundTile);
     }
     return performed;
-}
\ No newline at end of file
+}
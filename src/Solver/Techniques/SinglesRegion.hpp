@@ -3,6 +3,6 @@
 
 #include "Solver/Technique.hpp"
 
-NEW_TECHNIQUE(SinglesRegion);
+NEW_TECHNIQUE(SinglesRegion, EASY);
 
 #endif // __SINGLESREGION_H__
\ No newline at end of file
@@ -8,25 +8,28 @@
 
 bool SinglesTile::analyze()
 {
-    return true;
+    return m_solver.getSinglesQueue().hasNakedSingles();
 }
 
 bool SinglesTile::perform()
 {
     bool performed = false;
-    for (const auto& tile : m_solver.getGridTiles())
+    auto& singlesQueue = m_solver.getSinglesQueue();
+    // definir um valor pode deixar outros tiles com 1 sugestão, que entram na fila e são definidos
+    // no mesmo perform
+    while (singlesQueue.hasNakedSingles())
     {
-        if (tile->hasValue())
+        const auto tileIndex = singlesQueue.popNakedSingle();
+        const auto solverTile = m_solver(BoardGeometry::getRow(tileIndex), BoardGeometry::getCol(tileIndex));
+        if (solverTile->hasValue())
         {
             continue;
         }
 
-        const auto& solverTile = std::dynamic_pointer_cast<SolverTile>(tile);
-
         const auto& tileSuggestions = solverTile->getSuggestions();
         if (tileSuggestions.size() == 1)
         {
-            const auto& value = *tileSuggestions.cbegin();
+            const auto value = tileSuggestions.front();
             solverTile->setValue(value);
             performed = true;
 
@@ -39,4 +42,4 @@ bool SinglesTile::perform()
     }
 
     return performed;
-}
\ No newline at end of file
+}
@@ -3,6 +3,6 @@
 
 #include "Solver/Technique.hpp"
 
-NEW_TECHNIQUE(SinglesTile);
+NEW_TECHNIQUE(SinglesTile, BASIC);
 
 #endif // __SINGLESTILE_H__
\ No newline at end of file
@@ -0,0 +1,255 @@
+#include "FishFinder.hpp"
+
+#include "Solver/Combinations.hpp"
+#include "Solver/Solver.hpp"
+#include "Solver/SolverRegions.hpp"
+#include "Solver/SolverTile.hpp"
+
+#include <fmt/format.h>
+
+#include <array>
+#include <bit>
+#include <memory>
+#include <vector>
+
+namespace
+{
+using LineMask = ValuesPositions::LineMask;
+
+// um fish com fins tem no máximo 3 tiles fora das linhas de cobertura, todos num mesmo subgrid
+constexpr unsigned int MAX_FINS_COLUMNS = 3;
+
+BoardGeometry::TileIndex
+toTileIndex(const LineOrientation baseOrientation, const unsigned int baseLine, const unsigned int coverLine)
+{
+    const auto base = static_cast<TileValueType>(baseLine);
+    const auto cover = static_cast<TileValueType>(coverLine);
+    return baseOrientation == LineOrientation::HORIZONTAL ? BoardGeometry::toTileIndex(base, cover)
+                                                          : BoardGeometry::toTileIndex(cover, base);
+}
+
+template<typename Function>
+void forEachLine(const LineMask lines, Function&& function)
+{
+    Combinations::forEachElement(lines, std::forward<Function>(function));
+}
+} // namespace
+
+unsigned int FishPattern::getSize() const
+{
+    return static_cast<unsigned int>(std::popcount(baseLines));
+}
+
+std::string FishPattern::getName() const
+{
+    static const std::array<std::string, FishFinder::MAX_SIZE + 1> names = {
+        "", "", "X-Wing", "Swordfish", "Jellyfish"};
+    const auto& name = names[getSize()];
+    if (fins.empty())
+    {
+        return name;
+    }
+    return (isSashimi ? "Sashimi " : "Finned ") + name;
+}
+
+std::optional<FishPattern> FishFinder::findFish(const unsigned int size, const bool finned) const
+{
+    for (TileValueType value = 1; value <= 9; ++value)
+    {
+        for (const auto baseOrientation : {LineOrientation::HORIZONTAL, LineOrientation::VERTICAL})
+        {
+            if (auto fish = findFish(value, baseOrientation, size, finned))
+            {
+                return fish;
+            }
+        }
+    }
+    return std::nullopt;
+}
+
+std::optional<FishPattern> FishFinder::findFish(const TileValueType value,
+                                                const LineOrientation baseOrientation,
+                                                const unsigned int size,
+                                                const bool finned) const
+{
+    const auto& baseMasks = baseOrientation == LineOrientation::HORIZONTAL
+                                ? m_valuesPositions.rows[value - 1]
+                                : m_valuesPositions.cols[value - 1];
+
+    // linhas com 1 tile só servem de base com fins (sashimi); as outras não podem ter mais tiles do que as
+    // linhas de cobertura e os fins comportam
+    const auto minTilesCount = finned ? 1u : 2u;
+    const auto maxTilesCount = finned ? size + MAX_FINS_COLUMNS : size;
+    std::array<unsigned int, 9> candidateLines{};
+    unsigned int candidatesCount = 0;
+    for (unsigned int line = 0; line < baseMasks.size(); ++line)
+    {
+        const auto tilesCount = static_cast<unsigned int>(std::popcount(baseMasks[line]));
+        if (tilesCount >= minTilesCount && tilesCount <= maxTilesCount)
+        {
+            candidateLines[candidatesCount++] = line;
+        }
+    }
+
+    for (const auto baseCombination : Combinations(candidatesCount, size))
+    {
+        LineMask baseLines = 0;
+        LineMask baseCoverLines = 0;
+        Combinations::forEachElement(baseCombination, [&](const unsigned int i) {
+            baseLines |= static_cast<LineMask>(1u << candidateLines[i]);
+            baseCoverLines |= baseMasks[candidateLines[i]];
+        });
+
+        const auto coverLinesCount = static_cast<unsigned int>(std::popcount(baseCoverLines));
+        if (!finned)
+        {
+            if (coverLinesCount != size)
+            {
+                continue;
+            }
+            if (auto fish = buildFish(value, baseOrientation, baseLines, baseCoverLines))
+            {
+                return fish;
+            }
+            continue;
+        }
+
+        if (coverLinesCount <= size || coverLinesCount > size + MAX_FINS_COLUMNS)
+        {
+            continue;
+        }
+        // as linhas que sobram depois de escolher as de cobertura têm os fins
+        std::array<unsigned int, 9> coverCandidates{};
+        unsigned int coverCandidatesCount = 0;
+        forEachLine(baseCoverLines,
+                    [&](const unsigned int line) { coverCandidates[coverCandidatesCount++] = line; });
+        for (const auto coverCombination : Combinations(coverCandidatesCount, size))
+        {
+            LineMask coverLines = 0;
+            Combinations::forEachElement(coverCombination, [&](const unsigned int i) {
+                coverLines |= static_cast<LineMask>(1u << coverCandidates[i]);
+            });
+            if (auto fish = buildFish(value, baseOrientation, baseLines, coverLines))
+            {
+                return fish;
+            }
+        }
+    }
+    return std::nullopt;
+}
+
+std::optional<FishPattern> FishFinder::buildFish(const TileValueType value,
+                                                 const LineOrientation baseOrientation,
+                                                 const LineMask baseLines,
+                                                 const LineMask coverLines) const
+{
+    const auto& rowsMasks = m_valuesPositions.rows[value - 1];
+    const auto& colsMasks = m_valuesPositions.cols[value - 1];
+    const bool isHorizontal = baseOrientation == LineOrientation::HORIZONTAL;
+    const auto& baseMasks = isHorizontal ? rowsMasks : colsMasks;
+    const auto& coverMasks = isHorizontal ? colsMasks : rowsMasks;
+
+    FishPattern fish;
+    fish.value = value;
+    fish.baseOrientation = baseOrientation;
+    fish.baseLines = baseLines;
+    fish.coverLines = coverLines;
+
+    bool isValid = true;
+    forEachLine(baseLines, [&](const unsigned int baseLine) {
+        const auto tilesInCover = std::popcount(static_cast<LineMask>(baseMasks[baseLine] & coverLines));
+        // uma linha base sem tiles nas linhas de cobertura não faz parte do fish
+        isValid &= tilesInCover > 0;
+        fish.isSashimi |= tilesInCover == 1;
+        const auto finsLines = static_cast<LineMask>(baseMasks[baseLine] & ~coverLines);
+        forEachLine(finsLines, [&](const unsigned int finLine) {
+            fish.fins.insert(toTileIndex(baseOrientation, baseLine, finLine));
+        });
+    });
+    if (!isValid)
+    {
+        return std::nullopt;
+    }
+
+    std::optional<TileValueType> finsSubgrid;
+    for (const auto fin : fish.fins)
+    {
+        const auto subgrid = BoardGeometry::getSubgrid(fin);
+        if (finsSubgrid.has_value() && *finsSubgrid != subgrid)
+        {
+            return std::nullopt;
+        }
+        finsSubgrid = subgrid;
+    }
+    // sem fins, o isSashimi não se aplica
+    fish.isSashimi &= finsSubgrid.has_value();
+
+    forEachLine(coverLines, [&](const unsigned int coverLine) {
+        const auto otherLines = static_cast<LineMask>(coverMasks[coverLine] & ~baseLines);
+        forEachLine(otherLines, [&](const unsigned int line) {
+            const auto tileIndex = toTileIndex(baseOrientation, line, coverLine);
+            if (!finsSubgrid.has_value() || BoardGeometry::getSubgrid(tileIndex) == *finsSubgrid)
+            {
+                fish.eliminations.insert(tileIndex);
+            }
+        });
+    });
+    if (fish.eliminations.empty())
+    {
+        return std::nullopt;
+    }
+    return fish;
+}
+
+void applyFish(Solver& solver, const FishPattern& fish)
+{
+    const auto& horizontalLines = solver.getAllSolverHorizontalLines();
+    const auto& verticalLines = solver.getAllSolverVerticalLines();
+    const bool isHorizontal = fish.baseOrientation == LineOrientation::HORIZONTAL;
+
+    std::vector<std::shared_ptr<SolverLine>> baseLines;
+    forEachLine(fish.baseLines, [&](const unsigned int line) {
+        baseLines.emplace_back(isHorizontal ? horizontalLines[line] : verticalLines[line]);
+    });
+    std::vector<std::shared_ptr<SolverLine>> coverLines;
+    forEachLine(fish.coverLines, [&](const unsigned int line) {
+        coverLines.emplace_back(isHorizontal ? verticalLines[line] : horizontalLines[line]);
+    });
+
+    SolverTileVec removedFrom;
+    for (const auto tileIndex : fish.eliminations)
+    {
+        const auto& tile = solver(BoardGeometry::toCoordinates(tileIndex));
+        tile->removeSuggestion(fish.value);
+        removedFrom.emplace_back(tile);
+    }
+
+    if (fish.fins.empty())
+    {
+        solver.report("{}:\nAs sugestões de valor {} das linhas {} estão todas nas linhas {}. Como cada "
+                      "uma das primeiras precisa ter o valor em uma dessas linhas, ele não pode estar em "
+                      "outros tiles delas, e a sugestão foi removida dos tiles {}.",
+                      fish.getName(),
+                      fish.value,
+                      fmt::join(baseLines, ", "),
+                      fmt::join(coverLines, ", "),
+                      fmt::join(removedFrom, ", "));
+        return;
+    }
+
+    SolverTileVec fins;
+    for (const auto tileIndex : fish.fins)
+    {
+        fins.emplace_back(solver(BoardGeometry::toCoordinates(tileIndex)));
+    }
+    solver.report("{}:\nAs sugestões de valor {} das linhas {} estão nas linhas {}, a não ser pelos fins "
+                  "{}, que estão todos no mesmo quadrado. Se nenhum fin tiver o valor, ele não pode estar "
+                  "em outros tiles dessas linhas; se algum tiver, ele não pode estar em outros tiles do "
+                  "quadrado. Assim, a sugestão foi removida dos tiles {}, que estão nos dois casos.",
+                  fish.getName(),
+                  fish.value,
+                  fmt::join(baseLines, ", "),
+                  fmt::join(coverLines, ", "),
+                  fmt::join(fins, ", "),
+                  fmt::join(removedFrom, ", "));
+}
@@ -0,0 +1,67 @@
+#ifndef __FISHFINDER_H__
+#define __FISHFINDER_H__
+
+#include "Board/TileMask.hpp"
+#include "Solver/SolverState.hpp"
+#include "Util/GlobalDefinitions.hpp"
+
+#include <optional>
+#include <string>
+
+class Solver;
+
+// A fish of a value: size base lines (rows or columns) whose suggestions of the value are all in size cover
+// lines of the other orientation. Each base line must have the value in one of the cover lines, so the
+// value can be removed from the other tiles of the cover lines.
+//
+// A finned fish has base tiles outside the cover lines (the fins), all in the same subgrid: either a fin
+// has the value or the fish holds, so only the tiles of the cover lines in that subgrid lose the value. It
+// is a sashimi fish when a base line has a single tile in the cover lines.
+struct FishPattern
+{
+    TileValueType value{0};
+    LineOrientation baseOrientation{LineOrientation::HORIZONTAL};
+    // bit i is set when the line with index i is part of the fish
+    ValuesPositions::LineMask baseLines{0};
+    ValuesPositions::LineMask coverLines{0};
+    TileMask fins;
+    bool isSashimi{false};
+    TileMask eliminations;
+
+    unsigned int getSize() const;
+    // X-Wing, Swordfish or Jellyfish, preceded by Finned or Sashimi when it has fins
+    std::string getName() const;
+};
+
+// Looks for fish with eliminations over the positions of the values of a Solver. Base and cover lines are
+// picked as bit masks, so nothing is allocated while searching
+class FishFinder
+{
+  public:
+    static constexpr unsigned int MIN_SIZE = 2;
+    static constexpr unsigned int MAX_SIZE = 4;
+
+    explicit FishFinder(const ValuesPositions& valuesPositions)
+        : m_valuesPositions(valuesPositions)
+    {}
+
+    // the first fish of the given size, by value and then with rows as base lines before columns. When
+    // finned is true only fish with fins are looked for
+    std::optional<FishPattern> findFish(unsigned int size, bool finned) const;
+
+  private:
+    const ValuesPositions& m_valuesPositions;
+
+    std::optional<FishPattern>
+    findFish(TileValueType value, LineOrientation baseOrientation, unsigned int size, bool finned) const;
+    // the fish with the given base and cover lines, if it is valid and has eliminations
+    std::optional<FishPattern> buildFish(TileValueType value,
+                                         LineOrientation baseOrientation,
+                                         ValuesPositions::LineMask baseLines,
+                                         ValuesPositions::LineMask coverLines) const;
+};
+
+// removes the value of the fish from its eliminations and reports it
+void applyFish(Solver& solver, const FishPattern& fish);
+
+#endif // __FISHFINDER_H__
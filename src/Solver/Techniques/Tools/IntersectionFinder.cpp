@@ -0,0 +1,183 @@
+#include "IntersectionFinder.hpp"
+
+#include "Board/BoardGeometry.hpp"
+#include "Solver/Solver.hpp"
+#include "Solver/SolverRegions.hpp"
+#include "Solver/SolverTile.hpp"
+#include "Util/UtilFunctions.hpp"
+
+#include <fmt/format.h>
+
+namespace
+{
+constexpr unsigned int toOrientationIndex(const LineOrientation orientation)
+{
+    return orientation == LineOrientation::HORIZONTAL ? 0 : 1;
+}
+
+constexpr BoardGeometry::RegionIndex toLineRegionIndex(const LineOrientation orientation,
+                                                       const TileValueType line)
+{
+    return BoardGeometry::toRegionIndex(orientation == LineOrientation::HORIZONTAL
+                                            ? RegionSpecificType::HORIZONTAL_LINE
+                                            : RegionSpecificType::VERTICAL_LINE,
+                                        line);
+}
+
+// a linha tem um segmento em cada um dos 3 subgrids que ela atravessa
+constexpr TileValueType
+toSubgrid(const LineOrientation orientation, const TileValueType line, const unsigned int segment)
+{
+    const auto firstLineSubgrid = orientation == LineOrientation::HORIZONTAL ? (line / 3) * 3 : line / 3;
+    const auto segmentStep = orientation == LineOrientation::HORIZONTAL ? 1 : 3;
+    return static_cast<TileValueType>(firstLineSubgrid + segment * segmentStep);
+}
+
+// values of the other two entries of the three
+template<typename Getter>
+Suggestions othersOf(const unsigned int index, Getter&& getter)
+{
+    return getter((index + 1) % 3) | getter((index + 2) % 3);
+}
+} // namespace
+
+TileMask LockedCandidates::getIntersectionTiles() const
+{
+    return BoardGeometry::REGION_MASKS[BoardGeometry::toRegionIndex(RegionSpecificType::SUBGRID, subgrid)] &
+           BoardGeometry::REGION_MASKS[toLineRegionIndex(orientation, line)];
+}
+
+TileMask LockedCandidates::getTargetTiles() const
+{
+    const auto& subgridTiles =
+        BoardGeometry::REGION_MASKS[BoardGeometry::toRegionIndex(RegionSpecificType::SUBGRID, subgrid)];
+    const auto& lineTiles = BoardGeometry::REGION_MASKS[toLineRegionIndex(orientation, line)];
+    return isPointing ? lineTiles - subgridTiles : subgridTiles - lineTiles;
+}
+
+IntersectionFinder::IntersectionFinder(const ValuesPositions& valuesPositions)
+{
+    auto& rowsSegments = m_segments[toOrientationIndex(LineOrientation::HORIZONTAL)];
+    auto& colsSegments = m_segments[toOrientationIndex(LineOrientation::VERTICAL)];
+    for (TileValueType value = 1; value <= 9; ++value)
+    {
+        for (unsigned int line = 0; line < 9; ++line)
+        {
+            const auto rowPositions = valuesPositions.rows[value - 1][line];
+            const auto colPositions = valuesPositions.cols[value - 1][line];
+            for (unsigned int segment = 0; segment < 3; ++segment)
+            {
+                if (((rowPositions >> (segment * 3)) & 0b111) != 0)
+                {
+                    rowsSegments[line][segment].insert(value);
+                }
+                if (((colPositions >> (segment * 3)) & 0b111) != 0)
+                {
+                    colsSegments[line][segment].insert(value);
+                }
+            }
+        }
+    }
+}
+
+const IntersectionFinder::LineSegments&
+IntersectionFinder::getSegments(const LineOrientation orientation) const
+{
+    return m_segments[toOrientationIndex(orientation)];
+}
+
+std::optional<LockedCandidates> IntersectionFinder::findPointing(const TileValueType subgrid) const
+{
+    for (const auto orientation : {LineOrientation::HORIZONTAL, LineOrientation::VERTICAL})
+    {
+        const auto& segments = getSegments(orientation);
+        const bool isHorizontal = orientation == LineOrientation::HORIZONTAL;
+        // linhas do subgrid e o segmento delas que está nele
+        const unsigned int firstLine = (isHorizontal ? subgrid / 3 : subgrid % 3) * 3;
+        const unsigned int segment = isHorizontal ? subgrid % 3 : subgrid / 3;
+        for (unsigned int i = 0; i < 3; ++i)
+        {
+            const auto& lineSegments = segments[firstLine + i];
+            const auto otherLinesOfSubgrid =
+                othersOf(i, [&](const unsigned int j) { return segments[firstLine + j][segment]; });
+            const auto restOfLine = othersOf(segment, [&](const unsigned int j) { return lineSegments[j]; });
+            const auto values = (lineSegments[segment] - otherLinesOfSubgrid) & restOfLine;
+            if (!values.empty())
+            {
+                return LockedCandidates{
+                    values, subgrid, orientation, static_cast<TileValueType>(firstLine + i), true};
+            }
+        }
+    }
+    return std::nullopt;
+}
+
+std::optional<LockedCandidates> IntersectionFinder::findClaiming(const LineOrientation orientation,
+                                                                 const TileValueType line) const
+{
+    const auto& segments = getSegments(orientation);
+    const unsigned int firstLine = (line / 3) * 3;
+    const unsigned int i = line % 3;
+    const auto& lineSegments = segments[line];
+    for (unsigned int segment = 0; segment < 3; ++segment)
+    {
+        const auto restOfLine = othersOf(segment, [&](const unsigned int j) { return lineSegments[j]; });
+        const auto otherLinesOfSubgrid =
+            othersOf(i, [&](const unsigned int j) { return segments[firstLine + j][segment]; });
+        const auto values = (lineSegments[segment] - restOfLine) & otherLinesOfSubgrid;
+        if (!values.empty())
+        {
+            return LockedCandidates{values, toSubgrid(orientation, line, segment), orientation, line, false};
+        }
+    }
+    return std::nullopt;
+}
+
+bool applyLockedCandidates(Solver& solver, const LockedCandidates& lockedCandidates)
+{
+    SolverTileVec removedFrom;
+    for (const auto tileIndex : lockedCandidates.getTargetTiles())
+    {
+        const auto& tile = solver(BoardGeometry::toCoordinates(tileIndex));
+        if (tile->removeSuggestions(lockedCandidates.values))
+        {
+            removedFrom.emplace_back(tile);
+        }
+    }
+    if (removedFrom.empty())
+    {
+        return false;
+    }
+
+    SolverTileVec intersectionTiles;
+    for (const auto tileIndex : lockedCandidates.getIntersectionTiles())
+    {
+        intersectionTiles.emplace_back(solver(BoardGeometry::toCoordinates(tileIndex)));
+    }
+    const auto& regions = solver.getAllRegions();
+    const auto& subgrid =
+        *regions[BoardGeometry::toRegionIndex(RegionSpecificType::SUBGRID, lockedCandidates.subgrid)];
+    const auto& line = *regions[toLineRegionIndex(lockedCandidates.orientation, lockedCandidates.line)];
+
+    if (lockedCandidates.isPointing)
+    {
+        solver.report("Pointing:\nNo quadrado \"{}\", as sugestões de valor {} estão apenas nos tiles {}, "
+                      "que pertencem à linha \"{}\". Dessa forma, o valor precisa estar em um desses tiles, "
+                      "e as sugestões foram removidas dos outros tiles da linha: {}.",
+                      subgrid,
+                      joinContainer(lockedCandidates.values, ", "),
+                      fmt::join(intersectionTiles, ", "),
+                      line,
+                      fmt::join(removedFrom, ", "));
+        return true;
+    }
+    solver.report("Box/Line Reduction:\nNa linha \"{}\", as sugestões de valor {} estão apenas nos "
+                  "tiles {}, que pertencem ao quadrado \"{}\". Dessa forma, o valor precisa estar em um "
+                  "desses tiles, e as sugestões foram removidas dos outros tiles do quadrado: {}.",
+                  line,
+                  joinContainer(lockedCandidates.values, ", "),
+                  fmt::join(intersectionTiles, ", "),
+                  subgrid,
+                  fmt::join(removedFrom, ", "));
+    return true;
+}
@@ -0,0 +1,58 @@
+#ifndef __INTERSECTIONFINDER_H__
+#define __INTERSECTIONFINDER_H__
+
+#include "Board/TileMask.hpp"
+#include "Solver/SolverState.hpp"
+#include "Solver/Suggestions.hpp"
+#include "Util/GlobalDefinitions.hpp"
+
+#include <array>
+#include <optional>
+
+class Solver;
+
+// Values locked in the intersection (3 tiles) of a subgrid with a line:
+// - pointing: in the subgrid, the values are only suggested in the intersection, so they can be removed
+//   from the other tiles of the line;
+// - claiming (box/line reduction): in the line, the values are only suggested in the intersection, so
+//   they can be removed from the other tiles of the subgrid.
+struct LockedCandidates
+{
+    Suggestions values;
+    TileValueType subgrid{0};
+    LineOrientation orientation{LineOrientation::HORIZONTAL};
+    TileValueType line{0};
+    bool isPointing{true};
+
+    TileMask getIntersectionTiles() const;
+    // tiles that lose the values: the rest of the line when pointing, the rest of the subgrid when claiming
+    TileMask getTargetTiles() const;
+};
+
+// Looks for locked candidates in the 54 subgrid/line intersections. The values suggested in each
+// intersection are taken once from the positions of the values, so both directions are tested for all the
+// values at once with a few operations over the Suggestions of the intersections of a band (or stack)
+class IntersectionFinder
+{
+  public:
+    explicit IntersectionFinder(const ValuesPositions& valuesPositions);
+
+    // the first intersection of the subgrid, rows before columns, with values pointing to its line
+    std::optional<LockedCandidates> findPointing(TileValueType subgrid) const;
+    // the first intersection of the line with values claimed by its subgrid
+    std::optional<LockedCandidates> findClaiming(LineOrientation orientation, TileValueType line) const;
+
+  private:
+    // m_segments[orientation][line][segment]: values suggested in the 3 tiles of the line that are in its
+    // segment-th subgrid
+    using LineSegments = std::array<std::array<Suggestions, 3>, 9>;
+    std::array<LineSegments, 2> m_segments{};
+
+    const LineSegments& getSegments(LineOrientation orientation) const;
+};
+
+// removes the locked values from the target tiles and reports it. Returns false, without reporting, when
+// none of the target tiles had them
+bool applyLockedCandidates(Solver& solver, const LockedCandidates& lockedCandidates);
+
+#endif // __INTERSECTIONFINDER_H__
@@ -0,0 +1,212 @@
+#include "MedusaColoring.hpp"
+
+#include "Solver/Solver.hpp"
+
+#include <numeric>
+#include <vector>
+
+namespace
+{
+constexpr unsigned int COLORS_COUNT = 2;
+
+TileMask getSeenTiles(const TileMask& tiles)
+{
+    TileMask seenTiles;
+    for (const auto tileIndex : tiles) { seenTiles |= BoardGeometry::PEERS[tileIndex]; }
+    return seenTiles;
+}
+} // namespace
+
+MedusaColoring::MedusaColoring(const Solver& solver)
+    : m_solver(solver)
+{
+    std::iota(m_parents.begin(), m_parents.end(), Node{0});
+    m_sizes.fill(1);
+
+    const auto& valuesPositions = solver.getValuesPositions();
+    for (TileValueType value = 1; value <= 9; ++value)
+    {
+        m_valuesTiles[value - 1] = valuesPositions.getTiles(value);
+    }
+
+    // as duas sugestões de um tile bivalue
+    const auto& tilesSuggestions = solver.getTilesSuggestions();
+    for (const auto tileIndex : solver.getBivalueTiles().all)
+    {
+        const auto& pair = tilesSuggestions[tileIndex];
+        link(toNode(tileIndex, pair.front()), toNode(tileIndex, pair.back()));
+    }
+    // os dois tiles de um valor numa região
+    for (const auto& regionTiles : BoardGeometry::REGION_MASKS)
+    {
+        for (TileValueType value = 1; value <= 9; ++value)
+        {
+            const auto valueTiles = regionTiles & m_valuesTiles[value - 1];
+            if (valueTiles.size() != 2)
+            {
+                continue;
+            }
+            auto tile = valueTiles.begin();
+            const auto first = *tile;
+            link(toNode(first, value), toNode(*++tile, value));
+        }
+    }
+}
+
+MedusaColoring::Node MedusaColoring::findCluster(Node node, unsigned int& color) const
+{
+    // sem compressão de caminho: a união por tamanho já mantém as árvores rasas
+    color = 0;
+    while (m_parents[node] != node)
+    {
+        color ^= m_colorFlips[node];
+        node = m_parents[node];
+    }
+    return node;
+}
+
+unsigned int MedusaColoring::getClusterSize(const Node node) const
+{
+    unsigned int color = 0;
+    return m_sizes[findCluster(node, color)];
+}
+
+void MedusaColoring::link(const Node first, const Node second)
+{
+    unsigned int firstColor = 0;
+    unsigned int secondColor = 0;
+    auto firstCluster = findCluster(first, firstColor);
+    auto secondCluster = findCluster(second, secondColor);
+    if (firstCluster == secondCluster)
+    {
+        return;
+    }
+    if (m_sizes[firstCluster] < m_sizes[secondCluster])
+    {
+        std::swap(firstCluster, secondCluster);
+    }
+    m_parents[secondCluster] = firstCluster;
+    // as cores dos dois nós precisam ficar opostas
+    m_colorFlips[secondCluster] = static_cast<std::uint8_t>(firstColor ^ secondColor ^ 1u);
+    m_sizes[firstCluster] = static_cast<std::uint16_t>(m_sizes[firstCluster] + m_sizes[secondCluster]);
+}
+
+std::optional<MedusaFinding> MedusaColoring::findEliminations() const
+{
+    // cada cluster com pelo menos um link ganha uma posição em clustersColors, na ordem do seu primeiro nó
+    std::array<std::int16_t, NODES_COUNT> clustersSlots;
+    clustersSlots.fill(-1);
+    std::vector<ClusterColors> clustersColors;
+    std::vector<unsigned int> clustersSizes;
+
+    const auto& tilesSuggestions = m_solver.getTilesSuggestions();
+    for (BoardGeometry::TileIndex tileIndex = 0; tileIndex < BoardGeometry::TILES_COUNT; ++tileIndex)
+    {
+        for (const auto value : tilesSuggestions[tileIndex])
+        {
+            unsigned int color = 0;
+            const auto cluster = findCluster(toNode(tileIndex, value), color);
+            if (m_sizes[cluster] < 2)
+            {
+                continue;
+            }
+            if (clustersSlots[cluster] < 0)
+            {
+                clustersSlots[cluster] = static_cast<std::int16_t>(clustersColors.size());
+                clustersColors.emplace_back();
+                clustersSizes.emplace_back(m_sizes[cluster]);
+            }
+            clustersColors[clustersSlots[cluster]][color][value - 1].insert(tileIndex);
+        }
+    }
+
+    for (size_t i = 0; i < clustersColors.size(); ++i)
+    {
+        if (auto finding = findEliminations(clustersColors[i], clustersSizes[i]))
+        {
+            return finding;
+        }
+    }
+    return std::nullopt;
+}
+
+std::optional<MedusaFinding> MedusaColoring::findEliminations(const ClusterColors& colors,
+                                                              const unsigned int clusterSize) const
+{
+    MedusaFinding finding;
+    finding.clusterSize = clusterSize;
+
+    // uma cor que leva a uma contradição é falsa, e todas as suas sugestões são removidas
+    for (unsigned int color = 0; color < COLORS_COUNT; ++color)
+    {
+        TileMask coloredTiles;
+        bool isTwiceInTile = false;
+        bool isTwiceInRegion = false;
+        for (TileValueType value = 1; value <= 9; ++value)
+        {
+            const auto& valueTiles = colors[color][value - 1];
+            isTwiceInTile |= !(coloredTiles & valueTiles).empty();
+            coloredTiles |= valueTiles;
+            for (const auto& regionTiles : BoardGeometry::REGION_MASKS)
+            {
+                isTwiceInRegion |= (regionTiles & valueTiles).size() >= 2;
+            }
+        }
+        if (isTwiceInTile || isTwiceInRegion)
+        {
+            finding.rule = isTwiceInTile ? MedusaFinding::Rule::COLOR_TWICE_IN_TILE
+                                         : MedusaFinding::Rule::COLOR_TWICE_IN_REGION;
+            finding.eliminations = colors[color];
+            return finding;
+        }
+    }
+
+    std::array<TileMask, COLORS_COUNT> coloredTiles{};
+    std::array<std::array<TileMask, 9>, COLORS_COUNT> seenTiles{};
+    for (unsigned int color = 0; color < COLORS_COUNT; ++color)
+    {
+        for (TileValueType value = 1; value <= 9; ++value)
+        {
+            coloredTiles[color] |= colors[color][value - 1];
+            seenTiles[color][value - 1] = getSeenTiles(colors[color][value - 1]);
+        }
+    }
+
+    // remove as sugestões não coloridas nos tiles dados por getTiles para cada valor
+    const auto findUncolored = [&](const MedusaFinding::Rule rule,
+                                   auto&& getTiles) -> std::optional<MedusaFinding> {
+        bool found = false;
+        for (TileValueType value = 1; value <= 9; ++value)
+        {
+            const auto& uncoloredTiles =
+                m_valuesTiles[value - 1] - colors[0][value - 1] - colors[1][value - 1];
+            finding.eliminations[value - 1] = uncoloredTiles & getTiles(value);
+            found |= !finding.eliminations[value - 1].empty();
+        }
+        if (!found)
+        {
+            return std::nullopt;
+        }
+        finding.rule = rule;
+        return finding;
+    };
+
+    // um dos dois tiles coloridos é verdadeiro, então as outras sugestões do tile são falsas
+    if (auto twoColorsInTile = findUncolored(MedusaFinding::Rule::TWO_COLORS_IN_TILE, [&](TileValueType) {
+            return coloredTiles[0] & coloredTiles[1];
+        }))
+    {
+        return twoColorsInTile;
+    }
+    if (auto twoColorsElsewhere =
+            findUncolored(MedusaFinding::Rule::TWO_COLORS_ELSEWHERE, [&](const TileValueType value) {
+                return seenTiles[0][value - 1] & seenTiles[1][value - 1];
+            }))
+    {
+        return twoColorsElsewhere;
+    }
+    // o tile tem uma cor e vê o valor com a outra: ou ele é o valor da sua cor, ou o valor está no outro tile
+    return findUncolored(MedusaFinding::Rule::TWO_COLORS_UNIT_AND_TILE, [&](const TileValueType value) {
+        return (coloredTiles[0] & seenTiles[1][value - 1]) | (coloredTiles[1] & seenTiles[0][value - 1]);
+    });
+}
@@ -0,0 +1,85 @@
+#ifndef __MEDUSACOLORING_H__
+#define __MEDUSACOLORING_H__
+
+#include "Board/BoardGeometry.hpp"
+#include "Board/TileMask.hpp"
+#include "Util/GlobalDefinitions.hpp"
+
+#include <array>
+#include <cstdint>
+#include <optional>
+
+class Solver;
+
+// What a 3D Medusa coloring allows to remove. eliminations[value - 1] are the tiles that lose the value
+struct MedusaFinding
+{
+    enum class Rule
+    {
+        // a color is false: it appears twice in a tile or twice with the same value in a region
+        COLOR_TWICE_IN_TILE,
+        COLOR_TWICE_IN_REGION,
+        // the other suggestions of a tile with both colors
+        TWO_COLORS_IN_TILE,
+        // a suggestion that sees the value with both colors
+        TWO_COLORS_ELSEWHERE,
+        // a suggestion of a tile with one color that sees the value with the other color
+        TWO_COLORS_UNIT_AND_TILE
+    };
+
+    Rule rule{Rule::COLOR_TWICE_IN_TILE};
+    std::array<TileMask, 9> eliminations{};
+    // suggestions colored by the cluster
+    unsigned int clusterSize{0};
+};
+
+// Colors the suggestions of all the values at once (3D Medusa). Each suggestion (tile, value) is a node,
+// and nodes are joined when exactly one of them is true: the two suggestions of a bivalue tile and the two
+// tiles of a value in a region (conjugate pair). Every cluster of joined nodes has two colors, one of them
+// true.
+//
+// The clusters are kept in a flat union-find over the 729 nodes, where each node also stores whether its
+// color is the same as the one of its parent, so the whole board is colored without allocating a node per
+// suggestion.
+class MedusaColoring
+{
+  public:
+    using Node = std::uint16_t;
+    static constexpr Node NODES_COUNT = BoardGeometry::TILES_COUNT * 9;
+
+    static constexpr Node toNode(const BoardGeometry::TileIndex tileIndex, const TileValueType value)
+    {
+        return static_cast<Node>(tileIndex * 9 + value - 1);
+    }
+
+    explicit MedusaColoring(const Solver& solver);
+
+    // the cluster of the node and its color (0 or 1) in the cluster
+    Node findCluster(Node node, unsigned int& color) const;
+    // how many suggestions are in the cluster of the node
+    unsigned int getClusterSize(Node node) const;
+
+    // the first finding of the first cluster, by the order of the rules, with eliminations
+    std::optional<MedusaFinding> findEliminations() const;
+
+  private:
+    const Solver& m_solver;
+    // tiles with each value as a suggestion
+    std::array<TileMask, 9> m_valuesTiles{};
+
+    std::array<Node, NODES_COUNT> m_parents{};
+    // 1 when the color of the node is not the one of its parent
+    std::array<std::uint8_t, NODES_COUNT> m_colorFlips{};
+    std::array<std::uint16_t, NODES_COUNT> m_sizes{};
+
+    // joins the clusters of the nodes with opposite colors. Links that contradict the colors already given
+    // (only possible in boards without solution) are ignored
+    void link(Node first, Node second);
+
+    // tiles of each color, by value
+    using ClusterColors = std::array<std::array<TileMask, 9>, 2>;
+    std::optional<MedusaFinding> findEliminations(const ClusterColors& colors,
+                                                  unsigned int clusterSize) const;
+};
+
+#endif // __MEDUSACOLORING_H__
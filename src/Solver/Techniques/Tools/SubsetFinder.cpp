@@ -0,0 +1,111 @@
+#include "SubsetFinder.hpp"
+
+#include "Solver/Combinations.hpp"
+#include "Solver/SolverRegions.hpp"
+#include "Solver/SolverTile.hpp"
+
+#include <bit>
+
+std::string Subset::getSizeName() const
+{
+    static const std::array<std::string, SubsetFinder::MAX_SIZE + 1> names = {
+        "", "", "Pair", "Triple", "Quad"};
+    return names[getSize()];
+}
+
+SubsetFinder::SubsetFinder(const SolverRegion& region)
+{
+    const auto& solverTiles = region.getSolverTiles();
+    for (unsigned int position = 0; position < solverTiles.size(); ++position)
+    {
+        const auto& suggestions = solverTiles[position]->getSuggestions();
+        m_tilesSuggestions[position] = suggestions;
+        if (!suggestions.empty())
+        {
+            ++m_emptyTilesCount;
+        }
+        for (const auto value : suggestions)
+        {
+            m_valuesPositions[value - 1] |= static_cast<Subset::TilesMask>(1u << position);
+        }
+    }
+}
+
+std::optional<Subset> SubsetFinder::findNakedSubset(const unsigned int size) const
+{
+    // tiles com mais sugestões do que o tamanho nunca fazem parte do subset (e os com 1 são singles)
+    std::array<unsigned int, 9> candidateTiles{};
+    unsigned int candidatesCount = 0;
+    for (unsigned int position = 0; position < m_tilesSuggestions.size(); ++position)
+    {
+        const auto suggestionsCount = m_tilesSuggestions[position].size();
+        if (suggestionsCount >= 2 && suggestionsCount <= size)
+        {
+            candidateTiles[candidatesCount++] = position;
+        }
+    }
+    // sem outros tiles vazios na região, não há o que remover
+    if (m_emptyTilesCount <= size)
+    {
+        return std::nullopt;
+    }
+
+    for (const auto combination : Combinations(candidatesCount, size))
+    {
+        Subset subset;
+        Combinations::forEachElement(combination, [&](const unsigned int i) {
+            subset.values |= m_tilesSuggestions[candidateTiles[i]];
+            subset.tiles |= static_cast<Subset::TilesMask>(1u << candidateTiles[i]);
+        });
+        if (subset.values.size() != size)
+        {
+            continue;
+        }
+
+        Subset::TilesMask valuesPositions = 0;
+        for (const auto value : subset.values) { valuesPositions |= m_valuesPositions[value - 1]; }
+        if ((valuesPositions & ~subset.tiles) != 0)
+        {
+            return subset;
+        }
+    }
+    return std::nullopt;
+}
+
+std::optional<Subset> SubsetFinder::findHiddenSubset(const unsigned int size) const
+{
+    // valores em mais tiles do que o tamanho nunca fazem parte do subset (e os em 1 são singles)
+    std::array<TileValueType, 9> candidateValues{};
+    unsigned int candidatesCount = 0;
+    for (TileValueType value = 1; value <= 9; ++value)
+    {
+        const auto positionsCount = static_cast<unsigned int>(std::popcount(m_valuesPositions[value - 1]));
+        if (positionsCount >= 2 && positionsCount <= size)
+        {
+            candidateValues[candidatesCount++] = value;
+        }
+    }
+
+    for (const auto combination : Combinations(candidatesCount, size))
+    {
+        Subset subset;
+        Combinations::forEachElement(combination, [&](const unsigned int i) {
+            subset.values.insert(candidateValues[i]);
+            subset.tiles |= m_valuesPositions[candidateValues[i] - 1];
+        });
+        if (std::popcount(subset.tiles) != static_cast<int>(size))
+        {
+            continue;
+        }
+
+        bool hasOtherSuggestions = false;
+        Combinations::forEachElement(subset.tiles, [&](const unsigned int position) {
+            hasOtherSuggestions |= !(m_tilesSuggestions[position] - subset.values).empty();
+        });
+        if (hasOtherSuggestions)
+        {
+            return subset;
+        }
+    }
+    return std::nullopt;
+}
@@ -0,0 +1,56 @@
+#ifndef __SUBSETFINDER_H__
+#define __SUBSETFINDER_H__
+
+#include "Solver/Suggestions.hpp"
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+class SolverRegion;
+
+// size tiles of a region and size values, such that:
+// - naked subset: the tiles have no suggestions other than the values, so the values can be removed from
+//   the other tiles of the region;
+// - hidden subset: the values are not suggested in other tiles of the region, so the other suggestions of
+//   the tiles can be removed.
+struct Subset
+{
+    using TilesMask = std::uint16_t;
+
+    Suggestions values;
+    // bit i is set when the i-th tile of the region (see Region::getTiles) is part of the subset
+    TilesMask tiles{0};
+
+    unsigned int getSize() const { return values.size(); }
+    // Pair, Triple or Quad
+    std::string getSizeName() const;
+};
+
+// Finds naked and hidden subsets of size 2 to 4 in a region. The suggestions of the tiles and the positions
+// of the values in the region are taken once as bit masks, and the tiles (or values) that can't be part of
+// a subset of the size are left out before the combinations are enumerated, so the search is bounded by
+// C(9, 4) unions of masks and doesn't allocate. Only subsets with eliminations are returned.
+class SubsetFinder
+{
+  public:
+    static constexpr unsigned int MIN_SIZE = 2;
+    static constexpr unsigned int MAX_SIZE = 4;
+
+    explicit SubsetFinder(const SolverRegion& region);
+
+    std::optional<Subset> findNakedSubset(unsigned int size) const;
+    std::optional<Subset> findHiddenSubset(unsigned int size) const;
+
+    // tiles of the region without value
+    unsigned int getEmptyTilesCount() const { return m_emptyTilesCount; }
+
+  private:
+    std::array<Suggestions, 9> m_tilesSuggestions{};
+    // bit i of m_valuesPositions[value - 1] is set when the i-th tile of the region has the suggestion
+    std::array<Subset::TilesMask, 9> m_valuesPositions{};
+    unsigned int m_emptyTilesCount{0};
+};
+
+#endif // __SUBSETFINDER_H__
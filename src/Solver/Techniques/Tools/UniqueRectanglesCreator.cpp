@@ -9,7 +9,7 @@ namespace
 {
 SolverTileVec getPossiblePairs(const SolverRegion* fromRegion,
                                const SolverTilePtr& fromTile,
-                               const std::vector<TileValueType>& suggestions)
+                               const Suggestions& suggestions)
 {
     auto tilesWithSuggestions = fromRegion->getTilesWithAllSuggestions(suggestions);
     if (tilesWithSuggestions.size() < 2)
@@ -21,9 +21,9 @@ SolverTileVec getPossiblePairs(const SolverRegion* fromRegion,
 }
 } // namespace
 
-UniqueRectanglesCreator::UniqueRectanglesCreator(std::vector<TileValueType> biValueSuggestions,
+UniqueRectanglesCreator::UniqueRectanglesCreator(const std::vector<TileValueType>& biValueSuggestions,
                                                  std::shared_ptr<SolverLine> vLine)
-    : m_biValueSuggestions(std::move(biValueSuggestions))
+    : m_biValueSuggestions(biValueSuggestions.begin(), biValueSuggestions.end())
     , m_vLine(std::move(vLine))
 {}
 
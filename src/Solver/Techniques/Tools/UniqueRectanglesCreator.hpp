@@ -2,6 +2,7 @@
 #define __UNIQUERECTANGLESCREATOR_H__
 
 #include "Solver/SolverTypes.hpp"
+#include "Solver/Suggestions.hpp"
 #include "Util/GlobalDefinitions.hpp"
 
 #include <memory>
@@ -12,11 +13,12 @@ class SolverLine;
 class UniqueRectanglesCreator
 {
   private:
-    const std::vector<TileValueType> m_biValueSuggestions;
+    const Suggestions m_biValueSuggestions;
     const std::shared_ptr<SolverLine> m_vLine;
 
   public:
-    UniqueRectanglesCreator(std::vector<TileValueType> biValueSuggestions, std::shared_ptr<SolverLine> vLine);
+    UniqueRectanglesCreator(const std::vector<TileValueType>& biValueSuggestions,
+                            std::shared_ptr<SolverLine> vLine);
 
     std::vector<SolverTileVec> buildPossibleRectangles() const;
 };
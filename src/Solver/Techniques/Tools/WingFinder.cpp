@@ -0,0 +1,211 @@
+#include "WingFinder.hpp"
+
+#include "Solver/Solver.hpp"
+#include "Solver/SolverTile.hpp"
+
+#include <fmt/format.h>
+
+namespace
+{
+const SolverTilePtr& toSolverTile(const Solver& solver, const BoardGeometry::TileIndex tileIndex)
+{
+    return solver(BoardGeometry::toCoordinates(tileIndex));
+}
+} // namespace
+
+std::string Wing::getName() const
+{
+    switch (type)
+    {
+    case WingType::XY: return "XY-Wing";
+    case WingType::XYZ: return "XYZ-Wing";
+    case WingType::W: return "W-Wing";
+    }
+    return "";
+}
+
+std::optional<Wing> WingFinder::findXYWing() const
+{
+    const auto& tilesSuggestions = m_solver.getTilesSuggestions();
+    for (const auto pivot : m_solver.getBivalueTiles().all)
+    {
+        const auto& pivotSuggestions = tilesSuggestions[pivot];
+        for (const auto z : Suggestions::allValues() - pivotSuggestions)
+        {
+            if (auto wing =
+                    findPincers(WingType::XY, pivot, pivotSuggestions.front(), pivotSuggestions.back(), z))
+            {
+                return wing;
+            }
+        }
+    }
+    return std::nullopt;
+}
+
+std::optional<Wing> WingFinder::findXYZWing() const
+{
+    const auto& tilesSuggestions = m_solver.getTilesSuggestions();
+    const auto& bivalueTiles = m_solver.getBivalueTiles().all;
+    for (BoardGeometry::TileIndex pivot = 0; pivot < BoardGeometry::TILES_COUNT; ++pivot)
+    {
+        const auto& pivotSuggestions = tilesSuggestions[pivot];
+        // o pivot precisa ver os dois pincers
+        if (pivotSuggestions.size() != 3 || (BoardGeometry::PEERS[pivot] & bivalueTiles).size() < 2)
+        {
+            continue;
+        }
+        for (const auto z : pivotSuggestions)
+        {
+            const auto xy = pivotSuggestions - Suggestions{z};
+            if (auto wing = findPincers(WingType::XYZ, pivot, xy.front(), xy.back(), z))
+            {
+                return wing;
+            }
+        }
+    }
+    return std::nullopt;
+}
+
+std::optional<Wing> WingFinder::findPincers(const WingType type,
+                                            const BoardGeometry::TileIndex pivot,
+                                            const TileValueType x,
+                                            const TileValueType y,
+                                            const TileValueType z) const
+{
+    const auto& bivalueTiles = m_solver.getBivalueTiles();
+    const auto& pivotPeers = BoardGeometry::PEERS[pivot];
+    const auto xzPincers = bivalueTiles.getTiles(Suggestions{x, z}) & pivotPeers;
+    const auto yzPincers = bivalueTiles.getTiles(Suggestions{y, z}) & pivotPeers;
+    if (xzPincers.empty() || yzPincers.empty())
+    {
+        return std::nullopt;
+    }
+
+    // no XYZ-Wing o próprio pivot pode ser o z, então os tiles também precisam vê-lo
+    auto zTiles = m_solver.getValuesPositions().getTiles(z);
+    if (type == WingType::XYZ)
+    {
+        zTiles &= pivotPeers;
+    }
+    for (const auto xzPincer : xzPincers)
+    {
+        for (const auto yzPincer : yzPincers)
+        {
+            const auto eliminations =
+                BoardGeometry::PEERS[xzPincer] & BoardGeometry::PEERS[yzPincer] & zTiles;
+            if (!eliminations.empty())
+            {
+                Wing wing;
+                wing.type = type;
+                wing.value = z;
+                wing.pivot = pivot;
+                wing.pincers = {xzPincer, yzPincer};
+                wing.eliminations = eliminations;
+                return wing;
+            }
+        }
+    }
+    return std::nullopt;
+}
+
+std::optional<Wing> WingFinder::findWWing() const
+{
+    const auto& tilesSuggestions = m_solver.getTilesSuggestions();
+    const auto& bivalueTiles = m_solver.getBivalueTiles();
+    const auto& valuesPositions = m_solver.getValuesPositions();
+    for (const auto first : bivalueTiles.all)
+    {
+        const auto& pair = tilesSuggestions[first];
+        const auto& firstPeers = BoardGeometry::PEERS[first];
+        // se os pincers se vissem, o par já teria sido removido dos outros tiles por um naked pair
+        for (const auto second : bivalueTiles.getTiles(pair) - firstPeers)
+        {
+            if (second <= first)
+            {
+                continue;
+            }
+            const auto& secondPeers = BoardGeometry::PEERS[second];
+            for (const auto z : pair)
+            {
+                const auto eliminations = firstPeers & secondPeers & valuesPositions.getTiles(z);
+                if (eliminations.empty())
+                {
+                    continue;
+                }
+                const auto x = (pair - Suggestions{z}).front();
+                const auto xTiles = valuesPositions.getTiles(x);
+                for (const auto& regionTiles : BoardGeometry::REGION_MASKS)
+                {
+                    const auto linkTiles = regionTiles & xTiles;
+                    if (linkTiles.size() != 2)
+                    {
+                        continue;
+                    }
+                    auto linkTile = linkTiles.begin();
+                    const auto firstLinkTile = *linkTile;
+                    const auto secondLinkTile = *++linkTile;
+                    std::optional<std::array<BoardGeometry::TileIndex, 2>> link;
+                    if (firstPeers.contains(firstLinkTile) && secondPeers.contains(secondLinkTile))
+                    {
+                        link = std::array{firstLinkTile, secondLinkTile};
+                    }
+                    else if (firstPeers.contains(secondLinkTile) && secondPeers.contains(firstLinkTile))
+                    {
+                        link = std::array{secondLinkTile, firstLinkTile};
+                    }
+                    if (link.has_value())
+                    {
+                        Wing wing;
+                        wing.type = WingType::W;
+                        wing.value = z;
+                        wing.pincers = {first, second};
+                        wing.linkValue = x;
+                        wing.link = *link;
+                        wing.eliminations = eliminations;
+                        return wing;
+                    }
+                }
+            }
+        }
+    }
+    return std::nullopt;
+}
+
+void applyWing(Solver& solver, const Wing& wing)
+{
+    SolverTileVec removedFrom;
+    for (const auto tileIndex : wing.eliminations)
+    {
+        const auto& tile = toSolverTile(solver, tileIndex);
+        tile->removeSuggestion(wing.value);
+        removedFrom.emplace_back(tile);
+    }
+
+    const auto& firstPincer = *toSolverTile(solver, wing.pincers[0]);
+    const auto& secondPincer = *toSolverTile(solver, wing.pincers[1]);
+    if (wing.type == WingType::W)
+    {
+        solver.report("{}:\nOs tiles {} e {} têm as mesmas sugestões e estão ligados pelos tiles {} e {}, "
+                      "que são os únicos da sua região com o valor {}. Como os dois não podem ter o valor "
+                      "{}, um deles tem o valor {}, que foi removido dos tiles que veem os dois: {}.",
+                      wing.getName(),
+                      firstPincer,
+                      secondPincer,
+                      *toSolverTile(solver, wing.link[0]),
+                      *toSolverTile(solver, wing.link[1]),
+                      wing.linkValue,
+                      wing.linkValue,
+                      wing.value,
+                      fmt::join(removedFrom, ", "));
+        return;
+    }
+    solver.report("{}:\nO tile {} vê os tiles {} e {}. Qualquer que seja o valor do primeiro, um dos outros "
+                  "dois tem o valor {}, que foi removido dos tiles que veem {}: {}.",
+                  wing.getName(),
+                  *toSolverTile(solver, wing.pivot),
+                  firstPincer,
+                  secondPincer,
+                  wing.value,
+                  wing.type == WingType::XYZ ? "os três" : "os dois últimos",
+                  fmt::join(removedFrom, ", "));
+}
@@ -0,0 +1,69 @@
+#ifndef __WINGFINDER_H__
+#define __WINGFINDER_H__
+
+#include "Board/BoardGeometry.hpp"
+#include "Board/TileMask.hpp"
+#include "Util/GlobalDefinitions.hpp"
+
+#include <array>
+#include <optional>
+#include <string>
+
+class Solver;
+
+enum class WingType
+{
+    XY,
+    XYZ,
+    W
+};
+
+// A wing removes value from the tiles that see both pincers:
+// - XY-Wing: a pivot {x, y} sees the pincers {x, z} and {y, z}. Whatever the pivot is, one pincer is z;
+// - XYZ-Wing: the same, with a pivot {x, y, z}, so the tiles must also see the pivot;
+// - W-Wing: two pincers {x, z} that don't see each other are joined by a strong link on x (a region where x
+//   is only in the link tiles, each one seen by a pincer). The pincers can't both be x, so one is z.
+struct Wing
+{
+    WingType type{WingType::XY};
+    TileValueType value{0};
+    // XY and XYZ only
+    BoardGeometry::TileIndex pivot{0};
+    std::array<BoardGeometry::TileIndex, 2> pincers{};
+    // W only: the value and the tiles of the strong link, the first one seen by the first pincer
+    TileValueType linkValue{0};
+    std::array<BoardGeometry::TileIndex, 2> link{};
+    TileMask eliminations;
+
+    std::string getName() const;
+};
+
+// Looks for wings with eliminations. Pivots and pincers are looked up in the bivalue tiles of the Solver
+// (grouped by pair of suggestions) and matched with the peers masks, so only the tiles that can take part
+// in a wing are visited
+class WingFinder
+{
+  public:
+    explicit WingFinder(const Solver& solver)
+        : m_solver(solver)
+    {}
+
+    std::optional<Wing> findXYWing() const;
+    std::optional<Wing> findXYZWing() const;
+    std::optional<Wing> findWWing() const;
+
+  private:
+    const Solver& m_solver;
+
+    // the first pair of pincers, seen by the pivot, with the pairs {x, z} and {y, z} and eliminations
+    std::optional<Wing> findPincers(WingType type,
+                                    BoardGeometry::TileIndex pivot,
+                                    TileValueType x,
+                                    TileValueType y,
+                                    TileValueType z) const;
+};
+
+// removes the value of the wing from its eliminations and reports it
+void applyWing(Solver& solver, const Wing& wing);
+
+#endif // __WINGFINDER_H__
@@ -21,7 +21,7 @@ class UniqueRectanglesAnalyzer
                              const std::vector<TileValueType>& suggestions,
                              const Solver& solver)
         : m_solver(solver)
-        , m_targetSuggestions(suggestions)
+        , m_targetSuggestions(suggestions.begin(), suggestions.end())
         , m_tiles(tiles)
     {
         assert(tiles.size() == 4);
@@ -101,13 +101,9 @@ class UniqueRectanglesAnalyzer
         }
 
         // we must fetch the extra suggestion now
-        auto roofSuggestionsCopy = roofTile1->getSuggestions();
-        std::erase_if(roofSuggestionsCopy, [&](const TileValueType& suggestion) {
-            return std::find(m_targetSuggestions.begin(), m_targetSuggestions.end(), suggestion) !=
-                   m_targetSuggestions.end();
-        });
-        assert(roofSuggestionsCopy.size() == 1);
-        const auto& extraSuggestion = *roofSuggestionsCopy.begin();
+        const auto extraSuggestions = roofTile1->getSuggestions() - m_targetSuggestions;
+        assert(extraSuggestions.size() == 1);
+        const auto extraSuggestion = extraSuggestions.front();
 
         // now, we must check if the tiles seen by the roof tiles has the extra suggestion
         const auto seenTiles = SolverUtils::getMutuallySeenTiles(m_roofTiles);
@@ -171,21 +167,14 @@ class UniqueRectanglesAnalyzer
         }
 
         // we must fetch the extra suggestions now
-        const auto& roof1Suggestions = roofTile1->getSuggestions();
-        const auto found1 = std::find_if_not(
-            roof1Suggestions.begin(), roof1Suggestions.end(), [&](const TileValueType& suggestion) {
-                return suggestion == m_targetSuggestions.front() || suggestion == m_targetSuggestions.back();
-            });
-        assert(found1 != roof1Suggestions.end());
-        const auto& extraSuggestion1 = *found1;
-
-        const auto& roof2Suggestions = roofTile2->getSuggestions();
-        const auto found2 = std::find_if_not(
-            roof2Suggestions.begin(), roof2Suggestions.end(), [&](const TileValueType& suggestion) {
-                return suggestion == m_targetSuggestions.front() || suggestion == m_targetSuggestions.back();
-            });
-        assert(found2 != roof2Suggestions.end());
-        const auto& extraSuggestion2 = *found2;
+        const auto roof1ExtraSuggestions = roofTile1->getSuggestions() - m_targetSuggestions;
+        assert(!roof1ExtraSuggestions.empty());
+        const auto extraSuggestion1 = roof1ExtraSuggestions.front();
+
+        const auto roof2ExtraSuggestions = roofTile2->getSuggestions() - m_targetSuggestions;
+        assert(!roof2ExtraSuggestions.empty());
+        const auto extraSuggestion2 = roof2ExtraSuggestions.front();
+        const Suggestions extraSuggestions{extraSuggestion1, extraSuggestion2};
 
         // now, we gather all the seen tiles
         const auto seenTiles = SolverUtils::getMutuallySeenTiles(m_roofTiles);
@@ -199,11 +188,7 @@ class UniqueRectanglesAnalyzer
             {
                 continue;
             }
-            const auto& seenTileSuggestions = seenTile->getSuggestions();
-            const auto isLockedSet = std::all_of(
-                seenTileSuggestions.begin(), seenTileSuggestions.end(), [&](const TileValueType& suggestion) {
-                    return suggestion == extraSuggestion1 || suggestion == extraSuggestion2;
-                });
+            const auto isLockedSet = extraSuggestions.containsAll(seenTile->getSuggestions());
             if (isLockedSet)
             {
                 lockedSetPossibilities.emplace_back(seenTile);
@@ -223,13 +208,12 @@ class UniqueRectanglesAnalyzer
             const auto seenTiles = SolverUtils::getMutuallySeenTiles({roofTile1, roofTile2, lockedSetTile});
             for (const auto& seenTile : seenTiles)
             {
-                if (seenTile->hasValue() || (!seenTile->hasSuggestion(extraSuggestion1) &&
-                                             !seenTile->hasSuggestion(extraSuggestion2)))
+                if (seenTile->hasValue() || !seenTile->getSuggestions().intersects(extraSuggestions))
                 {
                     continue;
                 }
 
-                const auto erased = seenTile->removeSuggestions({extraSuggestion1, extraSuggestion2});
+                const auto erased = seenTile->removeSuggestions(extraSuggestions);
                 assert(erased);
 
                 affectedTiles.emplace_back(seenTile);
@@ -274,11 +258,9 @@ class UniqueRectanglesAnalyzer
         const auto& roofTile1 = m_roofTiles.front();
         const auto& roofTile2 = m_roofTiles.back();
 
-        for (const auto& suggestion : m_targetSuggestions)
+        for (const auto suggestion : m_targetSuggestions)
         {
-            const auto& otherSuggestion = m_targetSuggestions.front() == suggestion
-                                              ? m_targetSuggestions.back()
-                                              : m_targetSuggestions.front();
+            const auto otherSuggestion = (m_targetSuggestions - Suggestions{suggestion}).front();
 
             // must check, at the roof, if one of the suggestion is the only one possible on the units shared
             // by boof roofs
@@ -318,7 +300,7 @@ class UniqueRectanglesAnalyzer
     }
 
     const Solver& m_solver;
-    std::vector<TileValueType> m_targetSuggestions;
+    const Suggestions m_targetSuggestions;
     const SolverTileVec m_tiles;
     SolverTileVec m_roofTiles;
     SolverTileVec m_floorTiles;
@@ -327,12 +309,10 @@ class UniqueRectanglesAnalyzer
 
 bool UniqueRectangles::analyze()
 {
-    std::unordered_map<TileValueType, int> suggestionsPerValue;
     for (const auto& vLine : m_solver.getAllSolverVerticalLines())
     {
         const auto& suggestionsQuan = vLine->getSuggestionsQuan();
-        const auto& candidateSuggestions = suggestionsQuan.getSuggestionsWithQuantityGreaterThan(1);
-        if (candidateSuggestions.size() >= 2)
+        if (suggestionsQuan.getSuggestionsWithQuantityGreaterThan(1).size() >= 2)
         {
             return true;
         }
@@ -351,7 +331,8 @@ bool UniqueRectangles::perform()
             continue;
         }
 
-        const auto combinations = SolverUtils::createCombination(2, candidateSuggestions);
+        const auto combinations = SolverUtils::createCombination(
+            2, std::vector<TileValueType>(candidateSuggestions.begin(), candidateSuggestions.end()));
         for (const auto& combination : combinations)
         {
 
@@ -3,6 +3,6 @@
 
 #include "Solver/Technique.hpp"
 
-NEW_TECHNIQUE(UniqueRectangles);
+NEW_UNIQUENESS_TECHNIQUE(UniqueRectangles);
 
 #endif // __UNIQUERETANGLES_H__
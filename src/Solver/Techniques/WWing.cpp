@@ -0,0 +1,21 @@
+#include "WWing.hpp"
+
+#include "Solver/Solver.hpp"
+#include "Tools/WingFinder.hpp"
+
+bool WWing::analyze()
+{
+    // os pincers são sempre tiles com duas sugestões
+    return !getTilesToScan().empty() && m_solver.getBivalueTiles().all.size() >= 2;
+}
+
+bool WWing::perform()
+{
+    if (const auto wing = WingFinder(m_solver).findWWing())
+    {
+        applyWing(m_solver, *wing);
+        return true;
+    }
+    markTilesScanned(TileMask::allTiles());
+    return false;
+}
@@ -0,0 +1,8 @@
+#ifndef __WWING_H__
+#define __WWING_H__
+
+#include "Solver/Technique.hpp"
+
+NEW_TECHNIQUE(WWing, ADVANCED);
+
+#endif // __WWING_H__
@@ -0,0 +1,21 @@
+#include "XYWing.hpp"
+
+#include "Solver/Solver.hpp"
+#include "Tools/WingFinder.hpp"
+
+bool XYWing::analyze()
+{
+    // os pincers são sempre tiles com duas sugestões
+    return !getTilesToScan().empty() && m_solver.getBivalueTiles().all.size() >= 2;
+}
+
+bool XYWing::perform()
+{
+    if (const auto wing = WingFinder(m_solver).findXYWing())
+    {
+        applyWing(m_solver, *wing);
+        return true;
+    }
+    markTilesScanned(TileMask::allTiles());
+    return false;
+}
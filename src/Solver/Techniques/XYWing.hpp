@@ -0,0 +1,8 @@
+#ifndef __XYWING_H__
+#define __XYWING_H__
+
+#include "Solver/Technique.hpp"
+
+NEW_TECHNIQUE(XYWing, ADVANCED);
+
+#endif // __XYWING_H__
@@ -0,0 +1,21 @@
+#include "XYZWing.hpp"
+
+#include "Solver/Solver.hpp"
+#include "Tools/WingFinder.hpp"
+
+bool XYZWing::analyze()
+{
+    // os pincers são sempre tiles com duas sugestões
+    return !getTilesToScan().empty() && m_solver.getBivalueTiles().all.size() >= 2;
+}
+
+bool XYZWing::perform()
+{
+    if (const auto wing = WingFinder(m_solver).findXYZWing())
+    {
+        applyWing(m_solver, *wing);
+        return true;
+    }
+    markTilesScanned(TileMask::allTiles());
+    return false;
+}
@@ -0,0 +1,8 @@
+#ifndef __XYZWING_H__
+#define __XYZWING_H__
+
+#include "Solver/Technique.hpp"
+
+NEW_TECHNIQUE(XYZWing, ADVANCED);
+
+#endif // __XYZWING_H__
@@ -1,18 +1,192 @@
 #include "Board/Grid.hpp"
+#include "GameGenerator.hpp"
 #include "Games.hpp"
+#include "Solver/BatchSolver.hpp"
 #include "Solver/Reporter.hpp"
 #include "Solver/Solver.hpp"
 
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
 #include <iostream>
+#include <random>
 #include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
 
 void printAction(const std::string& action)
 {
     std::cout << action << std::endl;
 }
 
-int main()
+void printUsage(const char* program)
 {
+    std::cerr << "Usage: " << program
+              << " [--batch [--threads N] [--engine techniques|dlx] [--filter-unique | --rate] [file]]\n"
+              << "  --batch [file]  solves one puzzle per line from file (or stdin if omitted or '-'),\n"
+              << "                  writing one solution per line to stdout and a summary to stderr\n"
+              << "  --threads N     number of worker threads used by --batch (default: all cores)\n"
+              << "  --engine E      'techniques' (default) solves like a human, 'dlx' uses dancing links\n"
+              << "  --filter-unique instead of solving, writes only the puzzles with exactly one solution\n"
+              << "  --rate          like --filter-unique, followed by the difficulty score of each puzzle,\n"
+              << "                  the hardest technique needed and the number of steps\n"
+              << "       " << program << " --generate D [--count N] [--threads N] [--seed S]\n"
+              << "  --generate D    writes N (default 1) new puzzles of difficulty D to stdout and the rate\n"
+              << "                  to stderr. D is simple, easy, intermediate, expert, any or all\n"
+              << "  --seed S        the same seed always generates the same puzzles (default: random)\n";
+}
+
+int runBatch(const std::string& inputPath,
+             const unsigned int threadsCount,
+             const BatchSolver::Engine engine,
+             const BatchSolver::Mode mode)
+{
+    std::ios::sync_with_stdio(false);
+
+    BatchSolver batchSolver(threadsCount, 0, engine);
+    batchSolver.setMode(mode);
+    BatchSolverSummary summary;
+    if (inputPath.empty() || inputPath == "-")
+    {
+        summary = batchSolver.run(std::cin, std::cout);
+    }
+    else
+    {
+        std::ifstream input(inputPath);
+        if (!input)
+        {
+            std::cerr << "Could not open " << inputPath << "\n";
+            return 1;
+        }
+        summary = batchSolver.run(input, std::cout);
+    }
+
+    std::cerr << summary.toString() << " [" << batchSolver.getThreadsCount() << " threads]" << std::endl;
+    return 0;
+}
+
+int runGenerate(const std::string& difficultyName,
+                const size_t count,
+                const unsigned int threadsCount,
+                const std::uint64_t seed)
+{
+    std::vector<GameDifficulty> difficulties;
+    if (difficultyName == "all")
+    {
+        difficulties = {GameDifficulty::Simple,
+                        GameDifficulty::Easy,
+                        GameDifficulty::Intermediate,
+                        GameDifficulty::Expert};
+    }
+    else if (const auto difficulty = gameDifficultyFromString(difficultyName))
+    {
+        difficulties = {*difficulty};
+    }
+    else
+    {
+        std::cerr << "Unknown difficulty " << difficultyName << "\n";
+        return 1;
+    }
+
+    for (const auto difficulty : difficulties)
+    {
+        GenerationSummary summary;
+        const auto puzzles =
+            GameGenerator::generateInParallel(difficulty, count, threadsCount, seed, &summary);
+        for (const auto& puzzle : puzzles) { std::cout << puzzle << '\n'; }
+        std::cout.flush();
+        std::cerr << summary.toString() << " [" << summary.workersCount << " threads]" << std::endl;
+    }
+    return 0;
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc > 2 && std::string_view(argv[1]) == "--generate")
+    {
+        const std::string difficultyName(argv[2]);
+        size_t count = 1;
+        unsigned int threadsCount = std::max(std::thread::hardware_concurrency(), 1u);
+        std::uint64_t seed = std::random_device{}();
+        for (int i = 3; i < argc; ++i)
+        {
+            const std::string_view argument(argv[i]);
+            if (argument == "--count" && i + 1 < argc)
+            {
+                count = static_cast<size_t>(std::max(std::atoll(argv[++i]), 1ll));
+            }
+            else if (argument == "--threads" && i + 1 < argc)
+            {
+                threadsCount = static_cast<unsigned int>(std::max(std::atoi(argv[++i]), 1));
+            }
+            else if (argument == "--seed" && i + 1 < argc)
+            {
+                seed = std::strtoull(argv[++i], nullptr, 10);
+            }
+            else
+            {
+                printUsage(argv[0]);
+                return 1;
+            }
+        }
+        return runGenerate(difficultyName, count, threadsCount, seed);
+    }
+
+    if (argc > 1)
+    {
+        if (std::string_view(argv[1]) != "--batch")
+        {
+            printUsage(argv[0]);
+            return 1;
+        }
+
+        std::string inputPath;
+        unsigned int threadsCount = std::max(std::thread::hardware_concurrency(), 1u);
+        auto engine = BatchSolver::Engine::TECHNIQUES;
+        auto mode = BatchSolver::Mode::SOLVE;
+        for (int i = 2; i < argc; ++i)
+        {
+            const std::string_view argument(argv[i]);
+            if (argument == "--threads" && i + 1 < argc)
+            {
+                threadsCount = static_cast<unsigned int>(std::max(std::atoi(argv[++i]), 1));
+            }
+            else if (argument == "--engine" && i + 1 < argc)
+            {
+                const std::string_view engineName(argv[++i]);
+                if (engineName == "dlx")
+                {
+                    engine = BatchSolver::Engine::DLX;
+                }
+                else if (engineName != "techniques")
+                {
+                    printUsage(argv[0]);
+                    return 1;
+                }
+            }
+            else if (argument == "--filter-unique")
+            {
+                mode = BatchSolver::Mode::FILTER_UNIQUE;
+            }
+            else if (argument == "--rate")
+            {
+                mode = BatchSolver::Mode::RATE;
+            }
+            else if (inputPath.empty() && (argument == "-" || !argument.starts_with("--")))
+            {
+                inputPath = argument;
+            }
+            else
+            {
+                printUsage(argv[0]);
+                return 1;
+            }
+        }
+        return runBatch(inputPath, threadsCount, engine, mode);
+    }
+
     // https://www.7sudoku.com/play-online
     // std::string game("5...8..49...5...3..673....115..........2.8..........187....415..3...2...49..5...3");
 
@@ -0,0 +1,206 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "Games.hpp"
+#include "Solver/Solver.hpp"
+#include "Solver/SolverTile.hpp"
+#include "Solver/Techniques/BoxLineReduction.hpp"
+#include "Solver/Techniques/FinnedFish.hpp"
+#include "Solver/Techniques/Fish.hpp"
+#include "Solver/Techniques/HiddenSubsets.hpp"
+#include "Solver/Techniques/HiddenUniqueRectangles.hpp"
+#include "Solver/Techniques/Medusa3D.hpp"
+#include "Solver/Techniques/NakedSubsets.hpp"
+#include "Solver/Techniques/PointingPair.hpp"
+#include "Solver/Techniques/SinglesChains.hpp"
+#include "Solver/Techniques/SinglesRegion.hpp"
+#include "Solver/Techniques/SinglesTile.hpp"
+#include "Solver/Techniques/UniqueRectangles.hpp"
+#include "Solver/Techniques/WWing.hpp"
+#include "Solver/Techniques/XYWing.hpp"
+#include "Solver/Techniques/XYZWing.hpp"
+
+#include <string>
+
+// Run with --reporter xml (or the run_benchmarks target) for machine readable results
+namespace
+{
+const std::string BENCHMARK_BOARD =
+    "..9.....43..6..2......53.........81.16.4.5..223..8...9...21....94..36.........6..";
+
+// the board with all of its suggestions computed, which is what the techniques start from
+SolverState getPreparedState()
+{
+    Solver solver(BENCHMARK_BOARD);
+    solver.computeAllSuggestions();
+    return solver.getState();
+}
+
+// restoring the state is part of the measure, since every run must start from the same board. Its cost
+// alone is measured by the "Solver setState" benchmark
+template<typename TechniqueType>
+void benchmarkTechnique(const std::string& name)
+{
+    Solver solver;
+    const auto state = getPreparedState();
+    TechniqueType technique(solver);
+
+    BENCHMARK("Technique " + name)
+    {
+        solver.setState(state);
+        return technique.run();
+    };
+}
+} // namespace
+
+TEST_CASE("Benchmark Solver construction", "[benchmark]")
+{
+    BENCHMARK("Solver from string")
+    {
+        return Solver(BENCHMARK_BOARD);
+    };
+
+    Solver solver;
+    BENCHMARK("Solver loadBoard")
+    {
+        solver.loadBoard(BENCHMARK_BOARD);
+    };
+}
+
+TEST_CASE("Benchmark Solver suggestions", "[benchmark]")
+{
+    Solver solver;
+    const auto state = Solver(BENCHMARK_BOARD).getState();
+    const auto preparedState = getPreparedState();
+
+    BENCHMARK("Solver setState")
+    {
+        solver.setState(preparedState);
+    };
+
+    BENCHMARK("Solver computeAllSuggestions")
+    {
+        solver.setState(state);
+        solver.computeAllSuggestions();
+    };
+
+    // the first empty tile receives the first of its suggestions, which removes it from all of its peers
+    SolverTilePtr emptyTile;
+    solver.setState(preparedState);
+    for (TileValueType i = 0; i < 81 && !emptyTile; ++i)
+    {
+        if (!solver(i / 9, i % 9)->hasValue())
+        {
+            emptyTile = solver(i / 9, i % 9);
+        }
+    }
+    const auto value = *emptyTile->getSuggestions().begin();
+
+    BENCHMARK("SolverTile setValue")
+    {
+        solver.setState(preparedState);
+        emptyTile->setValue(value);
+    };
+}
+
+TEST_CASE("Benchmark Techniques", "[benchmark]")
+{
+    benchmarkTechnique<SinglesTile>("SinglesTile");
+    benchmarkTechnique<SinglesRegion>("SinglesRegion");
+    benchmarkTechnique<PointingPair>("PointingPair");
+    benchmarkTechnique<BoxLineReduction>("BoxLineReduction");
+    benchmarkTechnique<NakedSubsets>("NakedSubsets");
+    benchmarkTechnique<HiddenSubsets>("HiddenSubsets");
+    benchmarkTechnique<Fish>("Fish");
+    benchmarkTechnique<XYWing>("XYWing");
+    benchmarkTechnique<XYZWing>("XYZWing");
+    benchmarkTechnique<WWing>("WWing");
+    benchmarkTechnique<SinglesChains>("SinglesChains");
+    benchmarkTechnique<FinnedFish>("FinnedFish");
+    benchmarkTechnique<Medusa3D>("Medusa3D");
+    benchmarkTechnique<UniqueRectangles>("UniqueRectangles");
+    benchmarkTechnique<HiddenUniqueRectangles>("HiddenUniqueRectangles");
+}
+
+// these accessors are called by every technique, so they must not pay for a dynamic_cast
+TEST_CASE("Benchmark Solver tile access", "[benchmark]")
+{
+    Solver solver;
+    solver.setState(getPreparedState());
+
+    BENCHMARK("Solver tile access")
+    {
+        size_t suggestionsCount = 0;
+        for (TileValueType row = 0; row < 9; ++row)
+        {
+            for (TileValueType col = 0; col < 9; ++col)
+            {
+                suggestionsCount += solver(row, col)->getSuggestionsCount();
+            }
+        }
+        return suggestionsCount;
+    };
+
+    BENCHMARK("SolverTile regions access")
+    {
+        size_t suggestionsCount = 0;
+        for (const auto& tile : solver.getGridTiles())
+        {
+            const auto solverTile = std::static_pointer_cast<SolverTile>(tile);
+            const SolverRegion* regions[] = {solverTile->getSolverHorizontalLine(),
+                                             solverTile->getSolverVerticalLine(),
+                                             solverTile->getSolverSubgrid()};
+            for (const auto* region : regions)
+            {
+                suggestionsCount += region->getSuggestionsQuan().getValidSuggestions().size();
+            }
+        }
+        return suggestionsCount;
+    };
+}
+
+TEST_CASE("Benchmark Grid copy", "[benchmark]")
+{
+    const Grid grid(BENCHMARK_BOARD);
+
+    // builds the tiles and regions of the new Grid before copying the state
+    BENCHMARK("Grid copy construction")
+    {
+        return Grid(grid);
+    };
+
+    Grid copy;
+    BENCHMARK("Grid state copy")
+    {
+        copy.setGridState(grid.getGridState());
+        return copy.getGridState().values[0];
+    };
+}
+
+TEST_CASE("Benchmark solving the games", "[benchmark]")
+{
+    const auto& games = getGamesOfDifficulty(GameDifficulty::Any);
+
+    BENCHMARK("Solve all games")
+    {
+        unsigned int solvedCount = 0;
+        for (const auto& game : games)
+        {
+            Solver solver(game);
+            solvedCount += solver.trySolve() ? 1 : 0;
+        }
+        return solvedCount;
+    };
+
+    Solver solver;
+    BENCHMARK("Solve all games reusing the solver")
+    {
+        unsigned int solvedCount = 0;
+        for (const auto& game : games)
+        {
+            solver.loadBoard(game);
+            solvedCount += solver.trySolve() ? 1 : 0;
+        }
+        return solvedCount;
+    };
+}
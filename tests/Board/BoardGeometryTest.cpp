@@ -0,0 +1,119 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "Board/BoardGeometry.hpp"
+#include "Board/Grid.hpp"
+#include "Board/Line.hpp"
+#include "Board/Subgrid.hpp"
+#include "Board/Tile.hpp"
+#include "GamesManager/Games.hpp"
+
+namespace
+{
+void requireRegionMatchesTable(const Region& region)
+{
+    const auto& regionTiles = BoardGeometry::getRegionTiles(
+        region.getRegionSpecificType(), static_cast<TileValueType>(region.getIndex()));
+
+    size_t position = 0;
+    for (const auto& tile : region)
+    {
+        REQUIRE(tile->getIndex() == regionTiles[position]);
+        ++position;
+    }
+    REQUIRE(position == regionTiles.size());
+}
+} // namespace
+
+TEST_CASE("Test BoardGeometry indexes", "[BoardGeometry]")
+{
+    for (TileValueType row = 0; row < 9; ++row)
+    {
+        for (TileValueType col = 0; col < 9; ++col)
+        {
+            const auto tileIndex = BoardGeometry::toTileIndex(row, col);
+            REQUIRE(BoardGeometry::getRow(tileIndex) == row);
+            REQUIRE(BoardGeometry::getCol(tileIndex) == col);
+            REQUIRE(BoardGeometry::getSubgrid(tileIndex) == (row / 3) * 3 + col / 3);
+            REQUIRE(BoardGeometry::toCoordinates(tileIndex) == Coordinates{row, col});
+        }
+    }
+
+    static_assert(BoardGeometry::toRegionIndex(RegionSpecificType::SUBGRID, 8) == 8);
+    static_assert(BoardGeometry::toRegionIndex(RegionSpecificType::HORIZONTAL_LINE, 0) == 9);
+    static_assert(BoardGeometry::toRegionIndex(RegionSpecificType::VERTICAL_LINE, 8) == 26);
+}
+
+TEST_CASE("Test BoardGeometry tables match the Grid regions", "[BoardGeometry]")
+{
+    const Grid grid;
+
+    for (const auto& line : grid.getHorizontalLines()) { requireRegionMatchesTable(*line); }
+    for (const auto& line : grid.getVerticalLines()) { requireRegionMatchesTable(*line); }
+    for (const auto& subgrid : grid.getSubgrids()) { requireRegionMatchesTable(*subgrid); }
+
+    for (TileValueType row = 0; row < 9; ++row)
+    {
+        for (TileValueType col = 0; col < 9; ++col)
+        {
+            const auto& tile = grid(row, col);
+            const auto& tileRegions = BoardGeometry::TILE_REGIONS[tile->getIndex()];
+            const auto regions = tile->getRegions();
+            for (size_t i = 0; i < regions.size(); ++i)
+            {
+                REQUIRE(tileRegions[i] ==
+                        BoardGeometry::toRegionIndex(regions[i]->getRegionSpecificType(),
+                                                     static_cast<TileValueType>(regions[i]->getIndex())));
+            }
+        }
+    }
+}
+
+TEST_CASE("Test Grid state", "[BoardGeometry]")
+{
+    Grid grid(getGameOfDifficulty(GameDifficulty::Any));
+    const auto state = grid.getGridState();
+
+    for (TileValueType row = 0; row < 9; ++row)
+    {
+        for (TileValueType col = 0; col < 9; ++col)
+        {
+            REQUIRE(state.values[BoardGeometry::toTileIndex(row, col)] == grid(row, col)->getValue());
+        }
+    }
+
+    Grid other;
+    other.setGridState(state);
+    for (TileValueType row = 0; row < 9; ++row)
+    {
+        for (TileValueType col = 0; col < 9; ++col)
+        {
+            REQUIRE(other(row, col)->getValue() == grid(row, col)->getValue());
+        }
+    }
+
+    grid(0, 0)->setValue(0);
+    REQUIRE(grid.getGridState().values[0] == 0);
+    REQUIRE(other(0, 0)->getValue() == state.values[0]);
+}
+
+TEST_CASE("Test BoardGeometry peers", "[BoardGeometry]")
+{
+    for (BoardGeometry::TileIndex tileIndex = 0; tileIndex < BoardGeometry::TILES_COUNT; ++tileIndex)
+    {
+        const auto& peers = BoardGeometry::PEERS[tileIndex];
+        REQUIRE(peers.size() == 20);
+        REQUIRE_FALSE(peers.contains(tileIndex));
+        for (BoardGeometry::TileIndex other = 0; other < BoardGeometry::TILES_COUNT; ++other)
+        {
+            const bool sameRow = BoardGeometry::getRow(tileIndex) == BoardGeometry::getRow(other);
+            const bool sameCol = BoardGeometry::getCol(tileIndex) == BoardGeometry::getCol(other);
+            const bool sameSubgrid = BoardGeometry::getSubgrid(tileIndex) == BoardGeometry::getSubgrid(other);
+            REQUIRE(peers.contains(other) == (other != tileIndex && (sameRow || sameCol || sameSubgrid)));
+
+            const auto commonRegions = BoardGeometry::COMMON_REGIONS[tileIndex][other];
+            REQUIRE(static_cast<bool>(commonRegions & 1) == sameRow);
+            REQUIRE(static_cast<bool>(commonRegions & 2) == sameCol);
+            REQUIRE(static_cast<bool>(commonRegions & 4) == sameSubgrid);
+        }
+    }
+}
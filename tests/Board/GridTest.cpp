@@ -93,20 +93,6 @@ class CustomComponentConstructor : public ComponentsConstructor
     {
         return std::make_shared<CustomSubgrid>(grid, index);
     }
-
-    std::shared_ptr<Tile> createTileCopy(Grid* grid, const std::shared_ptr<Tile>& tile) const override
-    {
-        return std::make_shared<CustomTile>(*std::dynamic_pointer_cast<CustomTile>(tile), grid);
-    }
-    std::shared_ptr<Line> createLineCopy(Grid* grid, const std::shared_ptr<Line>& line) const override
-    {
-        return std::make_shared<CustomLine>(*std::dynamic_pointer_cast<CustomLine>(line), grid);
-    }
-    std::shared_ptr<Subgrid> createSubgridCopy(Grid* grid,
-                                               const std::shared_ptr<Subgrid>& subgrid) const override
-    {
-        return std::make_shared<CustomSubgrid>(*std::dynamic_pointer_cast<CustomSubgrid>(subgrid), grid);
-    }
 };
 
 TEST_CASE("Test Custom ComponentConstructor", "[Grid]")
@@ -98,7 +98,7 @@ TEST_CASE("Test Line move constructors/assign operators", "[Line]")
             REQUIRE(tile->getHorizontalLine() == &lineMoved);
         }
 
-        REQUIRE_FALSE(line.getElementList());
+        for (const auto& tile : line.getTiles()) { REQUIRE_FALSE(tile); }
     }
 
     SECTION("Contructor - Vertical")
@@ -116,7 +116,7 @@ TEST_CASE("Test Line move constructors/assign operators", "[Line]")
             REQUIRE(tile->getVerticalLine() == &lineMoved);
         }
 
-        REQUIRE_FALSE(line.getElementList());
+        for (const auto& tile : line.getTiles()) { REQUIRE_FALSE(tile); }
     }
 
     SECTION("Operator - Horizontal")
@@ -134,7 +134,7 @@ TEST_CASE("Test Line move constructors/assign operators", "[Line]")
             REQUIRE(tile->getHorizontalLine() == &lineMoved);
         }
 
-        REQUIRE_FALSE(line.getElementList());
+        for (const auto& tile : line.getTiles()) { REQUIRE_FALSE(tile); }
     }
 
     SECTION("Operator - Vertical")
@@ -156,6 +156,6 @@ TEST_CASE("Test Line move constructors/assign operators", "[Line]")
             REQUIRE(tile->getVerticalLine() == &lineMoved);
         }
 
-        REQUIRE_FALSE(line.getElementList());
+        for (const auto& tile : line.getTiles()) { REQUIRE_FALSE(tile); }
     }
 }
@@ -25,47 +25,35 @@ TEST_CASE("Test Region Tiles-related APIs", "[Region]")
 {
     Grid gridMoc;
 
-    auto firstMocTile = std::make_shared<Tile>(&gridMoc, Coordinates{1, 2});
-    auto middleMocTile = std::make_shared<Tile>(&gridMoc, Coordinates{1, 2});
-    auto lastMocTile = std::make_shared<Tile>(&gridMoc, Coordinates{1, 2});
-    auto* first = new ElementWrapper<std::shared_ptr<Tile>>(&firstMocTile);
-    auto* middle = new ElementWrapper<std::shared_ptr<Tile>>(&middleMocTile, first);
-    auto* last = new ElementWrapper<std::shared_ptr<Tile>>(&lastMocTile, middle);
-
-    auto eList = std::make_shared<ElementList<std::shared_ptr<Tile>>>(first);
-
     Line line(&gridMoc, LineOrientation::HORIZONTAL, 1);
     Region* region = &line;
-    region->setElementList(eList);
 
     SECTION("Test Region iterator")
     {
-        const std::vector<ElementWrapper<std::shared_ptr<Tile>>*> golden = {first, middle, last};
-        auto goldenIt = golden.begin();
+        TileValueType col = 0;
         for (auto it = region->begin(); it != region->end(); ++it)
         {
-            REQUIRE(*it == (*goldenIt)->getElement());
-            REQUIRE(&(*it) == &(*goldenIt)->getElement());
-            ++goldenIt;
+            REQUIRE(*it == gridMoc(1, col));
+            REQUIRE(&(*it) == &region->getTiles()[col]);
+            ++col;
         }
+        REQUIRE(col == 9);
     }
 
-    SECTION("Test Region iterator")
+    SECTION("Test Region tiles access")
     {
-        const std::vector<ElementWrapper<std::shared_ptr<Tile>>*> golden = {first, middle, last};
-        auto goldenIt = golden.begin();
-        for (auto it = region->begin(); it != region->end(); ++it)
+        const auto& tileIndexes = region->getTileIndexes();
+        REQUIRE(tileIndexes == BoardGeometry::getRegionTiles(RegionSpecificType::HORIZONTAL_LINE, 1));
+        for (size_t i = 0; i < tileIndexes.size(); ++i)
         {
-            REQUIRE(*it == (*goldenIt)->getElement());
-            REQUIRE(&(*it) == &(*goldenIt)->getElement());
-            ++goldenIt;
+            REQUIRE(BoardGeometry::toTileIndex(region->getTiles()[i]->getCoordinates()) == tileIndexes[i]);
         }
     }
 
     SECTION("Test hasValue")
     {
         REQUIRE_FALSE(region->hasValue(3));
-        region->getTiles().getTail()->getElement()->setValue(3);
+        region->getTiles().back()->setValue(3);
         REQUIRE(region->hasValue(3));
     }
 
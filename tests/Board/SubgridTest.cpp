@@ -65,7 +65,7 @@ TEST_CASE("Test Subgrid move constructors/assign operators", "[Subgrid]")
             REQUIRE(tile->getSubgrid() == &subgridMoved);
         }
 
-        REQUIRE_FALSE(subgrid.getElementList());
+        for (const auto& tile : subgrid.getTiles()) { REQUIRE_FALSE(tile); }
     }
 
     SECTION("Operator")
@@ -86,6 +86,6 @@ TEST_CASE("Test Subgrid move constructors/assign operators", "[Subgrid]")
             REQUIRE(tile->getSubgrid() == &subgridMoved);
         }
 
-        REQUIRE_FALSE(subgrid.getElementList());
+        for (const auto& tile : subgrid.getTiles()) { REQUIRE_FALSE(tile); }
     }
 }
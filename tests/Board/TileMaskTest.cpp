@@ -0,0 +1,39 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "Board/TileMask.hpp"
+
+#include <vector>
+
+TEST_CASE("Test TileMask manipulation", "[TileMask]")
+{
+    TileMask tileMask;
+    REQUIRE(tileMask.empty());
+
+    tileMask.insert(0);
+    tileMask.insert(63);
+    tileMask.insert(64);
+    tileMask.insert(80);
+    REQUIRE(tileMask.size() == 4);
+    REQUIRE(tileMask.contains(63));
+    REQUIRE(tileMask.contains(64));
+    REQUIRE_FALSE(tileMask.contains(40));
+
+    tileMask.erase(63);
+    REQUIRE(tileMask == TileMask{0, 64, 80});
+
+    const std::vector<TileMask::IndexType> indexes(tileMask.begin(), tileMask.end());
+    REQUIRE(indexes == std::vector<TileMask::IndexType>{0, 64, 80});
+
+    REQUIRE(TileMask::allTiles().size() == 81);
+}
+
+TEST_CASE("Test TileMask set operations", "[TileMask]")
+{
+    const TileMask first{1, 2, 70};
+    const TileMask second{2, 70, 75};
+
+    REQUIRE((first | second) == TileMask{1, 2, 70, 75});
+    REQUIRE((first & second) == TileMask{2, 70});
+    REQUIRE((first - second) == TileMask{1});
+    REQUIRE((TileMask::allTiles() - first).size() == 78);
+}
@@ -0,0 +1,85 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "GamesManager/Games.hpp"
+#include "Solver/BatchSolver.hpp"
+#include "Solver/Solver.hpp"
+
+#include <sstream>
+
+TEST_CASE("Test BatchSolver", "[BatchSolver]")
+{
+    const std::string puzzle =
+        "530070000600195000098000060800060003400803001700020006060000280000419005000080079";
+    const std::string solution =
+        "534678912672195348198342567859761423426853791713924856961537284287419635345286179";
+
+    SECTION("One solution line per puzzle")
+    {
+        std::istringstream input("# comment\n" + puzzle + "\n\n" + puzzle + "\r\n");
+        std::ostringstream output;
+
+        const auto summary = BatchSolver().run(input, output);
+
+        REQUIRE(output.str() == solution + "\n" + solution + "\n");
+        REQUIRE(summary.puzzlesCount == 2);
+        REQUIRE(summary.unsolvedCount == 0);
+        REQUIRE(summary.invalidCount == 0);
+    }
+    SECTION("Invalid puzzles are echoed and counted")
+    {
+        std::istringstream input("53007{0000\n");
+        std::ostringstream output;
+
+        const auto summary = BatchSolver().run(input, output);
+
+        REQUIRE(output.str() == "53007{0000\n");
+        REQUIRE(summary.puzzlesCount == 1);
+        REQUIRE(summary.invalidCount == 1);
+    }
+}
+
+TEST_CASE("Test BatchSolver with multiple threads", "[BatchSolver]")
+{
+    std::string inputString;
+    for (int repetition = 0; repetition < 8; ++repetition)
+    {
+        for (const auto difficulty : {GameDifficulty::Simple,
+                                      GameDifficulty::Easy,
+                                      GameDifficulty::Intermediate,
+                                      GameDifficulty::Expert})
+        {
+            inputString += getGameOfDifficulty(difficulty) + "\n";
+        }
+    }
+    inputString += "53007{0000\n";
+
+    std::istringstream singleThreadedInput(inputString);
+    std::ostringstream singleThreadedOutput;
+    const auto singleThreadedSummary = BatchSolver().run(singleThreadedInput, singleThreadedOutput);
+
+    // a small reorder buffer forces the reader to wait for the workers
+    std::istringstream multiThreadedInput(inputString);
+    std::ostringstream multiThreadedOutput;
+    const auto multiThreadedSummary = BatchSolver(4, 3).run(multiThreadedInput, multiThreadedOutput);
+
+    REQUIRE(multiThreadedOutput.str() == singleThreadedOutput.str());
+    REQUIRE(multiThreadedSummary.puzzlesCount == singleThreadedSummary.puzzlesCount);
+    REQUIRE(multiThreadedSummary.unsolvedCount == singleThreadedSummary.unsolvedCount);
+    REQUIRE(multiThreadedSummary.invalidCount == 1);
+}
+
+TEST_CASE("Test Solver reuse", "[BatchSolver]")
+{
+    const auto firstPuzzle = getGameOfDifficulty(GameDifficulty::Simple);
+    const auto secondPuzzle = getGameOfDifficulty(GameDifficulty::Expert);
+
+    Solver reusedSolver;
+    BatchSolver::solvePuzzle(reusedSolver, firstPuzzle);
+    const auto reusedResult = BatchSolver::solvePuzzle(reusedSolver, secondPuzzle);
+
+    Solver freshSolver;
+    const auto freshResult = BatchSolver::solvePuzzle(freshSolver, secondPuzzle);
+
+    REQUIRE(reusedResult.line == freshResult.line);
+    REQUIRE(reusedResult.status == freshResult.status);
+}
@@ -0,0 +1,90 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "Solver/ChangeTracker.hpp"
+#include "Solver/Solver.hpp"
+#include "Solver/SolverTile.hpp"
+
+namespace
+{
+BoardGeometry::RegionMask getTileRegionsMask(const BoardGeometry::TileIndex tileIndex)
+{
+    BoardGeometry::RegionMask regions = 0;
+    for (const auto regionIndex : BoardGeometry::TILE_REGIONS[tileIndex])
+    {
+        regions |= BoardGeometry::RegionMask{1} << regionIndex;
+    }
+    return regions;
+}
+} // namespace
+
+TEST_CASE("Test ChangeTracker", "[ChangeTracker]")
+{
+    ChangeTracker changeTracker;
+    REQUIRE(changeTracker.getChangedTilesSince(0).empty());
+    REQUIRE(changeTracker.getChangedRegionsSince(0) == 0);
+
+    SECTION("Changes are newer than the stamps taken before them")
+    {
+        const auto stamp = changeTracker.advance();
+        changeTracker.markTileChanged(40);
+        REQUIRE(changeTracker.getChangedTilesSince(stamp) == TileMask{40});
+        REQUIRE(changeTracker.getChangedRegionsSince(stamp) == getTileRegionsMask(40));
+
+        const auto laterStamp = changeTracker.advance();
+        REQUIRE(changeTracker.getChangedTilesSince(laterStamp).empty());
+        REQUIRE(changeTracker.getChangedRegionsSince(laterStamp) == 0);
+        REQUIRE(changeTracker.getChangedTilesSince(stamp) == TileMask{40});
+    }
+    SECTION("Marking everything")
+    {
+        const auto stamp = changeTracker.advance();
+        changeTracker.markAllChanged();
+        REQUIRE(changeTracker.getChangedTilesSince(stamp) == TileMask::allTiles());
+        REQUIRE(changeTracker.getChangedRegionsSince(stamp) == BoardGeometry::ALL_REGIONS_MASK);
+    }
+}
+
+TEST_CASE("Test Solver change tracking", "[ChangeTracker]")
+{
+    Solver solver("..9.....43..6..2......53.........81.16.4.5..223..8...9...21....94..36.........6..");
+    solver.computeAllSuggestions();
+    auto& changeTracker = solver.getChangeTracker();
+
+    SECTION("Removing a suggestion changes only the tile and its regions")
+    {
+        const auto stamp = changeTracker.advance();
+        const auto tile = solver(0, 0);
+        REQUIRE(tile->removeSuggestion(tile->getSuggestions().front()));
+        REQUIRE(changeTracker.getChangedTilesSince(stamp) == TileMask{0});
+        REQUIRE(changeTracker.getChangedRegionsSince(stamp) == getTileRegionsMask(0));
+
+        // remover uma sugestão que o tile não tem não é uma mudança
+        const auto laterStamp = changeTracker.advance();
+        REQUIRE_FALSE(tile->removeSuggestion(9));
+        REQUIRE(changeTracker.getChangedTilesSince(laterStamp).empty());
+    }
+    SECTION("Setting a value changes the peers that lost the suggestion")
+    {
+        const auto stamp = changeTracker.advance();
+        const auto tile = solver(0, 0);
+        const auto value = tile->getSuggestions().front();
+
+        TileMask expectedTiles{0};
+        for (const auto peer : BoardGeometry::PEERS[0])
+        {
+            if (solver(BoardGeometry::getRow(peer), BoardGeometry::getCol(peer))->hasSuggestion(value))
+            {
+                expectedTiles.insert(peer);
+            }
+        }
+        tile->setValue(value);
+        REQUIRE(changeTracker.getChangedTilesSince(stamp) == expectedTiles);
+    }
+    SECTION("Restoring a state changes everything")
+    {
+        const auto state = solver.getState();
+        const auto stamp = changeTracker.advance();
+        solver.setState(state);
+        REQUIRE(changeTracker.getChangedRegionsSince(stamp) == BoardGeometry::ALL_REGIONS_MASK);
+    }
+}
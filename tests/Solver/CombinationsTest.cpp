@@ -0,0 +1,55 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "Solver/Combinations.hpp"
+
+#include <bit>
+#include <set>
+#include <vector>
+
+TEST_CASE("Test Combinations", "[Combinations]")
+{
+    SECTION("Combinations are generated in colexicographic order")
+    {
+        const std::vector<Combinations::MaskType> golden = {0b0011, 0b0101, 0b0110, 0b1001, 0b1010, 0b1100};
+        const Combinations combinations(4, 2);
+        REQUIRE(std::vector<Combinations::MaskType>(combinations.begin(), combinations.end()) == golden);
+    }
+    SECTION("All the k-combinations, each one once")
+    {
+        for (unsigned int n = 1; n <= 9; ++n)
+        {
+            size_t expectedCount = 1;
+            for (unsigned int k = 1; k <= n; ++k)
+            {
+                expectedCount = expectedCount * (n - k + 1) / k;
+                std::set<Combinations::MaskType> seen;
+                for (const auto combination : Combinations(n, k))
+                {
+                    REQUIRE(std::popcount(combination) == static_cast<int>(k));
+                    REQUIRE(combination < (Combinations::MaskType{1} << n));
+                    REQUIRE(seen.insert(combination).second);
+                }
+                REQUIRE(seen.size() == expectedCount);
+            }
+        }
+    }
+    SECTION("Empty enumerations")
+    {
+        REQUIRE(Combinations(4, 0).begin() == Combinations(4, 0).end());
+        REQUIRE(Combinations(3, 4).begin() == Combinations(3, 4).end());
+        REQUIRE(Combinations(0, 1).begin() == Combinations(0, 1).end());
+    }
+    SECTION("The whole set is the only combination of size n")
+    {
+        const Combinations combinations(Combinations::MAX_ELEMENTS, Combinations::MAX_ELEMENTS);
+        auto it = combinations.begin();
+        REQUIRE(*it == (Combinations::MaskType{1} << Combinations::MAX_ELEMENTS) - 1);
+        REQUIRE(++it == combinations.end());
+    }
+    SECTION("Elements of a combination")
+    {
+        std::vector<unsigned int> elements;
+        Combinations::forEachElement(0b101001, [&](const unsigned int i) { elements.push_back(i); });
+        REQUIRE(elements == std::vector<unsigned int>{0, 3, 5});
+    }
+}
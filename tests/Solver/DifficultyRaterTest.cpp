@@ -0,0 +1,112 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "GamesManager/Games.hpp"
+#include "Solver/BatchSolver.hpp"
+#include "Solver/DifficultyRater.hpp"
+
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+
+TEST_CASE("Test DifficultyRater", "[DifficultyRater]")
+{
+    DifficultyRater rater;
+
+    SECTION("Singles only")
+    {
+        const auto rating = rater.rate(getGameOfDifficulty(GameDifficulty::Simple));
+        REQUIRE(rating.solutionsCount == SolutionsCount::UNIQUE);
+        REQUIRE(rating.solvedByTechniques);
+        REQUIRE(rating.hardestLevel == 1);
+        REQUIRE(rating.hardestTechniqueName == "SinglesTile");
+        REQUIRE(rating.hardestTier == TechniqueTier::BASIC);
+        REQUIRE(rating.stepsCount > 0);
+        REQUIRE(rating.score == DifficultyRating::SCORE_PER_LEVEL + rating.stepsCount);
+    }
+    SECTION("Boards the techniques can't solve are rated as search")
+    {
+        const auto rating =
+            rater.rate("..9.....43..6..2......53.........81.16.4.5..223..8...9...21....94..36.........6..");
+        REQUIRE(rating.solutionsCount == SolutionsCount::UNIQUE);
+        REQUIRE_FALSE(rating.solvedByTechniques);
+        REQUIRE(rating.hardestTechniqueName == DifficultyRater::SEARCH_NAME);
+        REQUIRE(rating.hardestTier == TechniqueTier::ADVANCED);
+        REQUIRE(rating.hardestLevel == rating.techniquesReport.techniques.size() + 1);
+    }
+    SECTION("Boards without solution")
+    {
+        // o tile 0 não tem nenhum valor possível
+        const auto rating = rater.rate(".23456789"
+                                       "1........");
+        REQUIRE(rating.solutionsCount == SolutionsCount::NONE);
+        REQUIRE(rating.score == 0);
+    }
+    SECTION("Invalid boards")
+    {
+        REQUIRE_THROWS_AS(rater.rate("53007{0000"), std::runtime_error);
+    }
+    SECTION("The hardest technique dominates the score")
+    {
+        // the games of each difficulty are rated above all the games of the easier ones
+        unsigned int previousMaxScore = 0;
+        for (const auto difficulty : {GameDifficulty::Simple,
+                                      GameDifficulty::Easy,
+                                      GameDifficulty::Intermediate,
+                                      GameDifficulty::Expert})
+        {
+            unsigned int minScore = ~0u;
+            unsigned int maxScore = 0;
+            for (const auto& game : getGamesOfDifficulty(difficulty))
+            {
+                const auto score = rater.rate(game).score;
+                minScore = std::min(minScore, score);
+                maxScore = std::max(maxScore, score);
+            }
+            REQUIRE(minScore > previousMaxScore);
+            previousMaxScore = maxScore;
+        }
+    }
+    SECTION("Rating doesn't depend on the previous boards")
+    {
+        const auto& game = getGameOfDifficulty(GameDifficulty::Intermediate);
+        const auto first = rater.rate(game);
+        rater.rate(getGameOfDifficulty(GameDifficulty::Expert));
+        const auto second = rater.rate(game);
+        REQUIRE(first.score == second.score);
+        REQUIRE(first.stepsCount == second.stepsCount);
+    }
+}
+
+TEST_CASE("Test BatchSolver rate mode", "[DifficultyRater]")
+{
+    const auto& simpleGame = getGameOfDifficulty(GameDifficulty::Simple);
+    std::string inputString = simpleGame + "\n";
+    for (const auto& game : getGamesOfDifficulty(GameDifficulty::Any)) { inputString += game + "\n"; }
+    // multiple solutions, invalid
+    inputString += std::string(81, '.') + "\n";
+    inputString += "53007{0000\n";
+
+    BatchSolver batchSolver;
+    batchSolver.setMode(BatchSolver::Mode::RATE);
+    std::istringstream input(inputString);
+    std::ostringstream output;
+    const auto summary = batchSolver.run(input, output);
+
+    REQUIRE(summary.invalidCount == 1);
+    REQUIRE(summary.multipleSolutionsCount == 1);
+
+    const auto rating = DifficultyRater().rate(simpleGame);
+    const auto firstLine = output.str().substr(0, output.str().find('\n'));
+    REQUIRE(firstLine == simpleGame + " " + std::to_string(rating.score) + " " + rating.hardestTechniqueName +
+                             " " + std::to_string(rating.stepsCount));
+
+    SECTION("Same output with multiple threads")
+    {
+        BatchSolver multiThreadedSolver(4, 3);
+        multiThreadedSolver.setMode(BatchSolver::Mode::RATE);
+        std::istringstream multiThreadedInput(inputString);
+        std::ostringstream multiThreadedOutput;
+        multiThreadedSolver.run(multiThreadedInput, multiThreadedOutput);
+        REQUIRE(multiThreadedOutput.str() == output.str());
+    }
+}
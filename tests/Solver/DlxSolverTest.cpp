@@ -0,0 +1,51 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "Solver/DlxSolver.hpp"
+#include "Solver/Solver.hpp"
+
+TEST_CASE("Test DlxSolver", "[DlxSolver]")
+{
+    DlxSolver dlxSolver;
+
+    SECTION("Solves hard boards")
+    {
+        dlxSolver.loadBoard(
+            "800000000003600000070090200050007000000045700000100030001000068008500010090000400");
+        REQUIRE(dlxSolver.solve());
+        REQUIRE(dlxSolver.getValuesString() ==
+                "812753649943682175675491283154237896369845721287169534521974368438526917796318452");
+        REQUIRE(dlxSolver.getSearchNodesCount() > 0);
+    }
+    SECTION("Matches the techniques solver")
+    {
+        const std::string board =
+            "6.9.2...43..6..2......53..6.9.362815168495..2235.8.469..621...394..36.....3...6..";
+        Solver solver(board);
+        REQUIRE(solver.trySolve());
+
+        dlxSolver.loadBoard(board);
+        REQUIRE(dlxSolver.solve());
+        REQUIRE(dlxSolver.getValuesString() == solver.getValuesString());
+        REQUIRE(dlxSolver.getBoardString() == solver.getBoardString());
+    }
+    SECTION("Respects candidate groups")
+    {
+        // o primeiro tile só pode ser 5 ou 6 e o puzzle tem solução com 5
+        dlxSolver.loadBoard(
+            "{56}30070000600195000098000060800060003400803001700020006060000280000419005000080079");
+        REQUIRE(dlxSolver.solve());
+        REQUIRE(dlxSolver.getValuesString().front() == '5');
+
+        dlxSolver.loadBoard(
+            "{16}30070000600195000098000060800060003400803001700020006060000280000419005000080079");
+        REQUIRE_FALSE(dlxSolver.solve());
+    }
+    SECTION("Counts solutions")
+    {
+        dlxSolver.loadBoard("");
+        REQUIRE(dlxSolver.countSolutions(2) == 2);
+
+        dlxSolver.loadBoard("11");
+        REQUIRE(dlxSolver.countSolutions(2) == 0);
+    }
+}
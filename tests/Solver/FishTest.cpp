@@ -0,0 +1,119 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "Solver/Solver.hpp"
+#include "Solver/SolverTile.hpp"
+#include "Solver/Techniques/FinnedFish.hpp"
+#include "Solver/Techniques/Fish.hpp"
+#include "Solver/Techniques/Tools/FishFinder.hpp"
+#include "SolverTestUtils.hpp"
+
+#include <array>
+#include <utility>
+
+TEST_CASE("Test values positions", "[Fish]")
+{
+    Solver solver("530070000600195000098000060800060003400803001700020006060000280000419005000080079");
+    solver.computeAllSuggestions();
+
+    const auto& positions = solver.getValuesPositions();
+    const auto& tile = solver(0, 2);
+    for (const auto value : tile->getSuggestions())
+    {
+        REQUIRE((positions.rows[value - 1][0] & (1u << 2)) != 0);
+        REQUIRE((positions.cols[value - 1][2] & (1u << 0)) != 0);
+        REQUIRE(positions.getTiles(value).contains(tile->getIndex()));
+    }
+    // o valor do tile sai das posições
+    const auto value = tile->getSuggestions().front();
+    tile->setValue(value);
+    REQUIRE((positions.rows[value - 1][0] & (1u << 2)) == 0);
+    REQUIRE_FALSE(positions.getTiles(value).contains(tile->getIndex()));
+}
+
+TEST_CASE("Test Fish", "[Fish]")
+{
+    Solver solver;
+    solver.computeAllSuggestions();
+
+    SECTION("X-Wing")
+    {
+        // o 1 só pode estar nas colunas 3 e 7 das linhas B e E
+        keepValueInColumns(solver, 1, 1, {3, 7});
+        keepValueInColumns(solver, 1, 4, {3, 7});
+
+        Fish fish(solver);
+        REQUIRE(fish.run());
+        for (TileValueType row = 0; row < 9; ++row)
+        {
+            const bool isBaseRow = row == 1 || row == 4;
+            REQUIRE(solver(row, 2)->hasSuggestion(1) == isBaseRow);
+            REQUIRE(solver(row, 6)->hasSuggestion(1) == isBaseRow);
+            REQUIRE(solver(row, 0)->hasSuggestion(1) == !isBaseRow);
+        }
+        // the same fish, now seen by the columns, has nothing else to remove
+        REQUIRE_FALSE(fish.run());
+    }
+    SECTION("Swordfish with columns as base lines")
+    {
+        const std::array<std::pair<TileValueType, Suggestions>, 3> baseCols = {
+            std::pair{0, Suggestions{1, 4}}, {3, Suggestions{4, 8}}, {7, Suggestions{1, 8}}};
+        for (const auto& [col, rows] : baseCols)
+        {
+            for (TileValueType row = 0; row < 9; ++row)
+            {
+                if (!rows.contains(row + 1))
+                {
+                    solver(row, col)->removeSuggestion(5);
+                }
+            }
+        }
+
+        const auto fish = FishFinder(solver.getValuesPositions()).findFish(3, false);
+        REQUIRE(fish.has_value());
+        REQUIRE(fish->getName() == "Swordfish");
+        REQUIRE(fish->value == 5);
+        REQUIRE(fish->baseOrientation == LineOrientation::VERTICAL);
+        REQUIRE(fish->baseLines == 0b010001001);
+        REQUIRE(fish->coverLines == 0b010001001);
+        REQUIRE(fish->eliminations.size() == 3 * 6);
+
+        Fish fishTechnique(solver);
+        REQUIRE(fishTechnique.run());
+        REQUIRE_FALSE(solver(0, 1)->hasSuggestion(5));
+        REQUIRE(solver(0, 0)->hasSuggestion(5));
+        REQUIRE(solver(1, 1)->hasSuggestion(5));
+    }
+    SECTION("Finned X-Wing")
+    {
+        // o fin da linha E, na coluna 8, está no quadrado do meio à direita
+        keepValueInColumns(solver, 1, 1, {3, 7});
+        keepValueInColumns(solver, 1, 4, {3, 7, 8});
+
+        Fish fish(solver);
+        REQUIRE_FALSE(fish.run());
+
+        const auto finnedFish = FishFinder(solver.getValuesPositions()).findFish(2, true);
+        REQUIRE(finnedFish.has_value());
+        REQUIRE(finnedFish->getName() == "Finned X-Wing");
+        REQUIRE(finnedFish->fins == TileMask{BoardGeometry::toTileIndex(4, 7)});
+
+        FinnedFish finnedFishTechnique(solver);
+        REQUIRE(finnedFishTechnique.run());
+        REQUIRE_FALSE(solver(3, 6)->hasSuggestion(1));
+        REQUIRE_FALSE(solver(5, 6)->hasSuggestion(1));
+        // fora do quadrado do fin nada é removido
+        REQUIRE(solver(0, 6)->hasSuggestion(1));
+        REQUIRE(solver(3, 2)->hasSuggestion(1));
+    }
+    SECTION("Sashimi X-Wing")
+    {
+        keepValueInColumns(solver, 1, 1, {3, 7});
+        keepValueInColumns(solver, 1, 4, {3, 8, 9});
+
+        const auto fish = FishFinder(solver.getValuesPositions()).findFish(2, true);
+        REQUIRE(fish.has_value());
+        REQUIRE(fish->getName() == "Sashimi X-Wing");
+        REQUIRE(fish->eliminations ==
+                TileMask{BoardGeometry::toTileIndex(3, 6), BoardGeometry::toTileIndex(5, 6)});
+    }
+}
@@ -0,0 +1,87 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "GamesManager/GameGenerator.hpp"
+#include "Solver/DifficultyRater.hpp"
+#include "Solver/SolutionCounter.hpp"
+
+TEST_CASE("Test GameGenerator", "[GameGenerator]")
+{
+    GameGenerator generator(42);
+
+    SECTION("Solutions are complete and valid")
+    {
+        const auto solution = generator.generateSolution();
+        for (const auto& regionTiles : BoardGeometry::REGION_TILES)
+        {
+            Suggestions values;
+            for (const auto tileIndex : regionTiles) { values.insert(solution.values[tileIndex]); }
+            REQUIRE(values == Suggestions::allValues());
+        }
+    }
+    SECTION("Minimal puzzles")
+    {
+        const auto puzzle = generator.generateMinimalPuzzle();
+        SolutionCounter counter;
+        REQUIRE(counter.countSolutions(puzzle) == SolutionsCount::UNIQUE);
+
+        // no clue can be removed
+        for (size_t i = 0; i < puzzle.size(); ++i)
+        {
+            if (puzzle[i] == '.')
+                continue;
+            auto withoutClue = puzzle;
+            withoutClue[i] = '.';
+            REQUIRE(counter.countSolutions(withoutClue) == SolutionsCount::MULTIPLE);
+        }
+    }
+    SECTION("Puzzles of the requested difficulty")
+    {
+        DifficultyRater rater;
+        for (const auto difficulty : {GameDifficulty::Simple,
+                                      GameDifficulty::Easy,
+                                      GameDifficulty::Intermediate,
+                                      GameDifficulty::Expert})
+        {
+            const auto rating = rater.rate(generator.generate(difficulty));
+            REQUIRE(rating.solutionsCount == SolutionsCount::UNIQUE);
+            REQUIRE(getGameDifficultyOfRating(rating) == difficulty);
+        }
+        REQUIRE(generator.getAttemptsCount() >= 4);
+    }
+    SECTION("The same seed generates the same puzzles")
+    {
+        GameGenerator other(42);
+        REQUIRE(generator.generate(GameDifficulty::Easy) == other.generate(GameDifficulty::Easy));
+
+        other.seed(43);
+        generator.seed(43);
+        REQUIRE(generator.generateMinimalPuzzle() == other.generateMinimalPuzzle());
+    }
+}
+
+TEST_CASE("Test GameGenerator in parallel", "[GameGenerator]")
+{
+    GenerationSummary summary;
+    const auto puzzles = GameGenerator::generateInParallel(GameDifficulty::Intermediate, 6, 3, 7, &summary);
+    REQUIRE(puzzles.size() == 6);
+    REQUIRE(summary.difficulty == GameDifficulty::Intermediate);
+    REQUIRE(summary.puzzlesCount == 6);
+    REQUIRE(summary.attemptsCount >= 6);
+    REQUIRE(summary.workersCount == 3);
+
+    // each puzzle has its own seed, so the number of threads doesn't change them
+    REQUIRE(GameGenerator::generateInParallel(GameDifficulty::Intermediate, 6, 1, 7) == puzzles);
+
+    // no more threads than puzzles
+    GameGenerator::generateInParallel(GameDifficulty::Simple, 2, 8, 7, &summary);
+    REQUIRE(summary.workersCount == 2);
+}
+
+TEST_CASE("Test GameDifficulty names", "[GameGenerator]")
+{
+    REQUIRE(gameDifficultyFromString("expert") == GameDifficulty::Expert);
+    REQUIRE(gameDifficultyFromString("Intermediate") == GameDifficulty::Intermediate);
+    REQUIRE(gameDifficultyFromString("any") == GameDifficulty::Any);
+    REQUIRE_FALSE(gameDifficultyFromString("impossible").has_value());
+    REQUIRE(gameDifficultyToString(GameDifficulty::Easy) == "Easy");
+}
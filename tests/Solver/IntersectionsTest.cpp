@@ -0,0 +1,85 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "Solver/Solver.hpp"
+#include "Solver/SolverTile.hpp"
+#include "Solver/Techniques/BoxLineReduction.hpp"
+#include "Solver/Techniques/PointingPair.hpp"
+#include "Solver/Techniques/Tools/IntersectionFinder.hpp"
+
+TEST_CASE("Test intersection removal", "[Intersections]")
+{
+    Solver solver;
+    solver.computeAllSuggestions();
+
+    SECTION("Pointing")
+    {
+        // no quadrado 0 o 1 só pode estar na linha A, e no quadrado 4 o 2 só pode estar na coluna 5
+        for (TileValueType row = 1; row < 3; ++row)
+        {
+            for (TileValueType col = 0; col < 3; ++col) { solver(row, col)->removeSuggestion(1); }
+        }
+        for (TileValueType row = 3; row < 6; ++row)
+        {
+            solver(row, 3)->removeSuggestion(2);
+            solver(row, 5)->removeSuggestion(2);
+        }
+
+        const auto pointing = IntersectionFinder(solver.getValuesPositions()).findPointing(0);
+        REQUIRE(pointing.has_value());
+        REQUIRE(pointing->values == Suggestions{1});
+        REQUIRE(pointing->orientation == LineOrientation::HORIZONTAL);
+        REQUIRE(pointing->line == 0);
+        REQUIRE(pointing->isPointing);
+        REQUIRE(pointing->getIntersectionTiles() == TileMask{0, 1, 2});
+        REQUIRE(pointing->getTargetTiles() == TileMask{3, 4, 5, 6, 7, 8});
+        REQUIRE_FALSE(
+            IntersectionFinder(solver.getValuesPositions()).findClaiming(LineOrientation::HORIZONTAL, 0));
+
+        PointingPair pointingPair(solver);
+        REQUIRE(pointingPair.run());
+        for (TileValueType col = 3; col < 9; ++col)
+        {
+            REQUIRE_FALSE(solver(0, col)->hasSuggestion(1));
+        }
+        for (TileValueType row = 0; row < 9; ++row)
+        {
+            const bool isInSubgrid = row >= 3 && row < 6;
+            REQUIRE(solver(row, 4)->hasSuggestion(2) == isInSubgrid);
+        }
+        REQUIRE(solver(1, 3)->hasSuggestion(1));
+        REQUIRE_FALSE(pointingPair.run());
+    }
+    SECTION("Box/line reduction")
+    {
+        // na linha E o 3 só pode estar no quadrado do meio
+        for (TileValueType col = 0; col < 9; ++col)
+        {
+            if (col < 3 || col >= 6)
+            {
+                solver(4, col)->removeSuggestion(3);
+            }
+        }
+
+        const auto claiming =
+            IntersectionFinder(solver.getValuesPositions()).findClaiming(LineOrientation::HORIZONTAL, 4);
+        REQUIRE(claiming.has_value());
+        REQUIRE(claiming->values == Suggestions{3});
+        REQUIRE(claiming->subgrid == 4);
+        REQUIRE_FALSE(claiming->isPointing);
+        REQUIRE(claiming->getTargetTiles().size() == 6);
+
+        PointingPair pointingPair(solver);
+        REQUIRE_FALSE(pointingPair.run());
+
+        BoxLineReduction boxLineReduction(solver);
+        REQUIRE(boxLineReduction.run());
+        for (TileValueType col = 3; col < 6; ++col)
+        {
+            REQUIRE_FALSE(solver(3, col)->hasSuggestion(3));
+            REQUIRE(solver(4, col)->hasSuggestion(3));
+            REQUIRE_FALSE(solver(5, col)->hasSuggestion(3));
+        }
+        REQUIRE(solver(3, 2)->hasSuggestion(3));
+        REQUIRE_FALSE(boxLineReduction.run());
+    }
+}
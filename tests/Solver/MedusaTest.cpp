@@ -0,0 +1,173 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "Solver/Solver.hpp"
+#include "Solver/SolverTile.hpp"
+#include "Solver/Techniques/Medusa3D.hpp"
+#include "Solver/Techniques/Tools/MedusaColoring.hpp"
+#include "SolverTestUtils.hpp"
+
+TEST_CASE("Test 3D Medusa", "[Medusa]")
+{
+    Solver solver;
+    solver.computeAllSuggestions();
+
+    SECTION("Bivalue tiles and conjugate pairs of several values share a cluster")
+    {
+        solver(0, 0)->removeAllSuggestionsExceptFrom({1, 2});
+        keepValueInColumns(solver, 1, 0, {1, 6});
+        keepValueInColumns(solver, 2, 0, {1, 6});
+
+        const MedusaColoring coloring(solver);
+        const auto node = [](const TileValueType row, const TileValueType col, const TileValueType value) {
+            return MedusaColoring::toNode(BoardGeometry::toTileIndex(row, col), value);
+        };
+        unsigned int color1 = 0;
+        unsigned int color2 = 0;
+        const auto cluster = coloring.findCluster(node(0, 0, 1), color1);
+        REQUIRE(coloring.findCluster(node(0, 0, 2), color2) == cluster);
+        REQUIRE(color1 != color2);
+        REQUIRE(coloring.findCluster(node(0, 5, 1), color2) == cluster);
+        REQUIRE(color1 != color2);
+        REQUIRE(coloring.findCluster(node(0, 5, 2), color2) == cluster);
+        REQUIRE(color1 == color2);
+        REQUIRE(coloring.getClusterSize(node(0, 0, 1)) == 4);
+        REQUIRE(coloring.getClusterSize(node(1, 1, 9)) == 1);
+
+        // o tile (0, 5) tem as duas cores, então a solução dele é 1 ou 2
+        const auto finding = coloring.findEliminations();
+        REQUIRE(finding.has_value());
+        REQUIRE(finding->rule == MedusaFinding::Rule::TWO_COLORS_IN_TILE);
+        REQUIRE(finding->clusterSize == 4);
+
+        Medusa3D medusa(solver);
+        REQUIRE(medusa.run());
+        REQUIRE(solver(0, 5)->getSuggestions() == Suggestions{1, 2});
+        REQUIRE(solver(0, 0)->getSuggestions() == Suggestions{1, 2});
+        REQUIRE(solver(1, 5)->getSuggestionsCount() == 9);
+    }
+    SECTION("Suggestions that see both colors")
+    {
+        // A1, A5, E5 e E2 formam uma cadeia de 1s com cores alternadas
+        keepValueInColumns(solver, 1, 0, {1, 5});
+        keepValueInColumns(solver, 1, 4, {2, 5});
+        for (TileValueType row = 1; row < 9; ++row)
+        {
+            if (row != 4)
+            {
+                solver(row, 4)->removeSuggestion(1);
+            }
+        }
+
+        const auto finding = MedusaColoring(solver).findEliminations();
+        REQUIRE(finding.has_value());
+        REQUIRE(finding->rule == MedusaFinding::Rule::TWO_COLORS_ELSEWHERE);
+        REQUIRE(finding->eliminations[0] == TileMask{BoardGeometry::toTileIndex(1, 1),
+                                                     BoardGeometry::toTileIndex(2, 1),
+                                                     BoardGeometry::toTileIndex(3, 0),
+                                                     BoardGeometry::toTileIndex(5, 0)});
+        for (TileValueType value = 2; value <= 9; ++value)
+        {
+            REQUIRE(finding->eliminations[value - 1].empty());
+        }
+
+        Medusa3D medusa(solver);
+        REQUIRE(medusa.run());
+        REQUIRE_FALSE(solver(1, 1)->hasSuggestion(1));
+        REQUIRE_FALSE(solver(5, 0)->hasSuggestion(1));
+        REQUIRE(solver(1, 0)->hasSuggestion(1));
+        REQUIRE_FALSE(medusa.run());
+    }
+    SECTION("A color seen twice in a region is false")
+    {
+        // B3, E3 e E7 ligam o 2 de B3 ao 2 de B7 com a mesma cor, que aparece duas vezes na linha B
+        solver(1, 2)->removeAllSuggestionsExceptFrom({1, 2});
+        solver(4, 2)->removeAllSuggestionsExceptFrom({1, 3});
+        solver(4, 6)->removeAllSuggestionsExceptFrom({2, 3});
+        keepValueInColumns(solver, 3, 4, {3, 7});
+        for (TileValueType row = 0; row < 9; ++row)
+        {
+            if (row != 1 && row != 4)
+            {
+                solver(row, 2)->removeSuggestion(1);
+                solver(row, 6)->removeSuggestion(2);
+            }
+        }
+
+        const auto finding = MedusaColoring(solver).findEliminations();
+        REQUIRE(finding.has_value());
+        REQUIRE(finding->rule == MedusaFinding::Rule::COLOR_TWICE_IN_REGION);
+        REQUIRE(finding->clusterSize == 7);
+
+        Medusa3D medusa(solver);
+        REQUIRE(medusa.run());
+        REQUIRE(solver(1, 2)->getSuggestions() == Suggestions{1});
+        REQUIRE(solver(4, 2)->getSuggestions() == Suggestions{3});
+        REQUIRE(solver(4, 6)->getSuggestions() == Suggestions{2});
+        REQUIRE_FALSE(solver(1, 6)->hasSuggestion(2));
+    }    SECTION("A color twice in a tile is false")
+    {
+        // A1, E1, E5 e A5 formam um ciclo ímpar: o 1 e o 3 de E5 ficam com a mesma cor
+        solver(0, 0)->removeAllSuggestionsExceptFrom({1, 2});
+        solver(4, 0)->removeAllSuggestionsExceptFrom({2, 3});
+        keepValueInColumns(solver, 1, 0, {1, 5});
+        keepValueInColumns(solver, 3, 4, {1, 5});
+        for (TileValueType row = 1; row < 9; ++row)
+        {
+            if (row != 4)
+            {
+                solver(row, 0)->removeSuggestion(2);
+                solver(row, 4)->removeSuggestion(1);
+            }
+        }
+
+        const auto finding = MedusaColoring(solver).findEliminations();
+        REQUIRE(finding.has_value());
+        REQUIRE(finding->rule == MedusaFinding::Rule::COLOR_TWICE_IN_TILE);
+        REQUIRE(finding->clusterSize == 7);
+        const auto e5 = BoardGeometry::toTileIndex(4, 4);
+        REQUIRE(finding->eliminations[0] == TileMask{BoardGeometry::toTileIndex(0, 0), e5});
+        REQUIRE(finding->eliminations[1] == TileMask{BoardGeometry::toTileIndex(4, 0)});
+        REQUIRE(finding->eliminations[2] == TileMask{e5});
+        for (TileValueType value = 4; value <= 9; ++value)
+        {
+            REQUIRE(finding->eliminations[value - 1].empty());
+        }
+
+        Medusa3D medusa(solver);
+        REQUIRE(medusa.run());
+        REQUIRE(solver(0, 0)->getSuggestions() == Suggestions{2});
+        REQUIRE(solver(4, 0)->getSuggestions() == Suggestions{3});
+        REQUIRE(solver(4, 4)->getSuggestions() == Suggestions::allValues() - Suggestions{1, 3});
+        REQUIRE(solver(0, 4)->hasSuggestion(1));
+    }
+    SECTION("A tile with a color that sees the other color of a value")
+    {
+        // o 3 de A5 tem a cor oposta à do 1 de A1, então o 1 de A5 é falso
+        solver(0, 0)->removeAllSuggestionsExceptFrom({1, 2});
+        solver(4, 0)->removeAllSuggestionsExceptFrom({2, 3});
+        keepValueInColumns(solver, 3, 4, {1, 5});
+        for (TileValueType row = 1; row < 9; ++row)
+        {
+            if (row != 4)
+            {
+                solver(row, 0)->removeSuggestion(2);
+                solver(row, 4)->removeSuggestion(3);
+            }
+        }
+
+        const auto finding = MedusaColoring(solver).findEliminations();
+        REQUIRE(finding.has_value());
+        REQUIRE(finding->rule == MedusaFinding::Rule::TWO_COLORS_UNIT_AND_TILE);
+        REQUIRE(finding->clusterSize == 6);
+        REQUIRE(finding->eliminations[0] == TileMask{BoardGeometry::toTileIndex(0, 4)});
+        for (TileValueType value = 2; value <= 9; ++value)
+        {
+            REQUIRE(finding->eliminations[value - 1].empty());
+        }
+
+        Medusa3D medusa(solver);
+        REQUIRE(medusa.run());
+        REQUIRE(solver(0, 4)->getSuggestions() == Suggestions::allValues() - Suggestions{1});
+        REQUIRE(solver(4, 4)->hasSuggestion(1));
+    }
+}
@@ -0,0 +1,88 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "Solver/SinglesQueue.hpp"
+#include "Solver/Solver.hpp"
+#include "Solver/SolverTile.hpp"
+
+namespace
+{
+using HiddenSingle = std::pair<BoardGeometry::RegionIndex, TileValueType>;
+} // namespace
+
+TEST_CASE("Test SinglesQueue", "[SinglesQueue]")
+{
+    SinglesQueue singlesQueue;
+    singlesQueue.refill(GridState{}, SuggestionsState{});
+    REQUIRE_FALSE(singlesQueue.needsRefill());
+    REQUIRE_FALSE(singlesQueue.hasNakedSingles());
+    REQUIRE_FALSE(singlesQueue.hasHiddenSingles());
+
+    SECTION("Singles are taken in index order")
+    {
+        singlesQueue.pushNakedSingle(30);
+        singlesQueue.pushNakedSingle(3);
+        singlesQueue.pushNakedSingle(30);
+        REQUIRE(singlesQueue.popNakedSingle() == 3);
+        REQUIRE(singlesQueue.popNakedSingle() == 30);
+        REQUIRE_FALSE(singlesQueue.hasNakedSingles());
+
+        singlesQueue.pushHiddenSingle(20, 7);
+        singlesQueue.pushHiddenSingle(2, 9);
+        singlesQueue.pushHiddenSingle(2, 4);
+        REQUIRE(singlesQueue.popHiddenSingle() == HiddenSingle{2, 4});
+        REQUIRE(singlesQueue.popHiddenSingle() == HiddenSingle{2, 9});
+        REQUIRE(singlesQueue.popHiddenSingle() == HiddenSingle{20, 7});
+        REQUIRE_FALSE(singlesQueue.hasHiddenSingles());
+    }
+    SECTION("Refilling from a state")
+    {
+        SuggestionsState suggestionsState;
+        suggestionsState.tilesSuggestions[10] = Suggestions{5};
+        suggestionsState.regionsSuggestionsQuan[0].addSuggestion(5);
+        singlesQueue.refill(GridState{}, suggestionsState);
+        REQUIRE(singlesQueue.popNakedSingle() == 10);
+        REQUIRE(singlesQueue.popHiddenSingle() == HiddenSingle{0, 5});
+    }
+}
+
+TEST_CASE("Test Solver singles queue", "[SinglesQueue]")
+{
+    // a primeira linha só tem o tile (0, 0) vazio
+    Solver solver(".23456789");
+    solver.computeAllSuggestions();
+    auto& singlesQueue = solver.getSinglesQueue();
+
+    SECTION("Refilled from the computed suggestions")
+    {
+        REQUIRE(singlesQueue.hasNakedSingles());
+        REQUIRE(singlesQueue.popNakedSingle() == 0);
+    }
+    SECTION("Removing suggestions queues the new singles")
+    {
+        while (singlesQueue.hasNakedSingles()) { singlesQueue.popNakedSingle(); }
+        while (singlesQueue.hasHiddenSingles()) { singlesQueue.popHiddenSingle(); }
+
+        const auto tile = solver(4, 4);
+        REQUIRE(tile->getSuggestionsCount() > 2);
+        REQUIRE(tile->removeAllSuggestionsExceptFrom(Suggestions{tile->getSuggestions().front()}));
+        REQUIRE(singlesQueue.hasNakedSingles());
+        REQUIRE(singlesQueue.popNakedSingle() == BoardGeometry::toTileIndex(4, 4));
+    }
+}
+
+TEST_CASE("Test SinglesTile drains the queue in one perform", "[SinglesQueue]")
+{
+    // a primeira linha da solução apagada: todos os tiles dela são naked singles
+    Solver solver(".........943682175675491283154237896369845721287169534521974368438526917796318452");
+    REQUIRE(solver.trySolve());
+    REQUIRE(solver.getValuesString().starts_with("812753649"));
+
+    if constexpr (TECHNIQUE_STATISTICS_ENABLED)
+    {
+        const auto report = solver.getTechniquesReport();
+        const auto& singlesTile = report.techniques.front();
+        REQUIRE(singlesTile.techniqueName == "SinglesTile");
+        REQUIRE(singlesTile.statistics.performSuccessesCount == 1);
+        REQUIRE(singlesTile.statistics.placedValuesCount == 9);
+    }
+}
@@ -0,0 +1,111 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "Solver/BatchSolver.hpp"
+#include "Solver/SolutionCounter.hpp"
+#include "Solver/Solver.hpp"
+
+#include <sstream>
+
+namespace
+{
+const std::string HARD_BOARD =
+    "800000000003600000070090200050007000000045700000100030001000068008500010090000400";
+const std::string HARD_BOARD_SOLUTION =
+    "812753649943682175675491283154237896369845721287169534521974368438526917796318452";
+const std::string EMPTY_BOARD(81, '0');
+} // namespace
+
+TEST_CASE("Test SolutionCounter", "[SolutionCounter]")
+{
+    SolutionCounter counter;
+
+    SECTION("Unique boards")
+    {
+        REQUIRE(counter.countSolutions(HARD_BOARD) == SolutionsCount::UNIQUE);
+        REQUIRE(toValuesString(counter.getSolution()) == HARD_BOARD_SOLUTION);
+        REQUIRE(counter.countSolutions(HARD_BOARD_SOLUTION) == SolutionsCount::UNIQUE);
+    }
+    SECTION("Boards with more than one solution")
+    {
+        REQUIRE(counter.countSolutions(EMPTY_BOARD) == SolutionsCount::MULTIPLE);
+        REQUIRE(counter.countSolutions(GridState{}) == SolutionsCount::MULTIPLE);
+        REQUIRE(solutionsCountToString(SolutionsCount::MULTIPLE) == "2+");
+    }
+    SECTION("Boards without solution")
+    {
+        // dois 1 na mesma linha
+        REQUIRE(counter.countSolutions("11") == SolutionsCount::NONE);
+        // o tile 0 não tem nenhum valor possível
+        REQUIRE(counter.countSolutions(".23456789"
+                                       "1........") == SolutionsCount::NONE);
+        REQUIRE(solutionsCountToString(SolutionsCount::NONE) == "0");
+    }
+    SECTION("Respects candidate groups")
+    {
+        REQUIRE(counter.countSolutions(
+                    "{56}30070000600195000098000060800060003400803001700020006060000280000419005000080079") ==
+                SolutionsCount::UNIQUE);
+        REQUIRE(counter.countSolutions(
+                    "{16}30070000600195000098000060800060003400803001700020006060000280000419005000080079") ==
+                SolutionsCount::NONE);
+    }
+    SECTION("Invalid boards")
+    {
+        REQUIRE_THROWS_AS(counter.countSolutions("x"), std::runtime_error);
+    }
+}
+
+TEST_CASE("Test Solver solutions count pre-pass", "[SolutionCounter]")
+{
+    SECTION("Unique boards keep every technique")
+    {
+        Solver solver(HARD_BOARD);
+        REQUIRE(solver.countSolutions() == SolutionsCount::UNIQUE);
+        REQUIRE(solver.trySolve());
+        REQUIRE(solver.getSolutionsCount() == SolutionsCount::UNIQUE);
+        REQUIRE(solver.getValuesString() == HARD_BOARD_SOLUTION);
+    }
+    SECTION("Boards with more than one solution are still solved")
+    {
+        Solver solver(EMPTY_BOARD);
+        REQUIRE(solver.trySolve());
+        REQUIRE(solver.getSolutionsCount() == SolutionsCount::MULTIPLE);
+        REQUIRE(solver.getValuesString().find('.') == std::string::npos);
+    }
+    SECTION("Boards without solution are rejected before solving")
+    {
+        Solver solver(".23456789"
+                      "1........");
+        REQUIRE_FALSE(solver.trySolve());
+        REQUIRE(solver.getSolutionsCount() == SolutionsCount::NONE);
+    }
+    SECTION("The check can be disabled")
+    {
+        Solver solver(HARD_BOARD);
+        solver.setSolutionsCountCheckEnabled(false);
+        REQUIRE(solver.trySolve());
+        REQUIRE_FALSE(solver.getSolutionsCount().has_value());
+    }
+}
+
+TEST_CASE("Test BatchSolver unique filter", "[SolutionCounter]")
+{
+    const auto input = HARD_BOARD + "\n" + EMPTY_BOARD + "\n11\nx\n" + HARD_BOARD_SOLUTION + "\n";
+
+    for (const unsigned int threadsCount : {1u, 2u})
+    {
+        BatchSolver batchSolver(threadsCount);
+        batchSolver.setMode(BatchSolver::Mode::FILTER_UNIQUE);
+
+        std::istringstream in(input);
+        std::ostringstream out;
+        const auto summary = batchSolver.run(in, out);
+
+        REQUIRE(out.str() == HARD_BOARD + "\n" + HARD_BOARD_SOLUTION + "\n");
+        REQUIRE(summary.puzzlesCount == 5);
+        REQUIRE(summary.noSolutionCount == 1);
+        REQUIRE(summary.multipleSolutionsCount == 1);
+        REQUIRE(summary.invalidCount == 1);
+        REQUIRE(summary.unsolvedCount == 0);
+    }
+}
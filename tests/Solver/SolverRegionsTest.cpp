@@ -0,0 +1,50 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "Solver/Solver.hpp"
+#include "Solver/SolverRegions.hpp"
+#include "Solver/SolverTile.hpp"
+
+#include <utility>
+
+TEST_CASE("Test Solver regions views", "[SolverRegion]")
+{
+    Solver solver;
+
+    SECTION("All regions are indexed as in BoardGeometry")
+    {
+        const auto& regions = solver.getAllRegions();
+        REQUIRE(regions.size() == BoardGeometry::REGIONS_COUNT);
+        for (BoardGeometry::RegionIndex regionIndex = 0; regionIndex < BoardGeometry::REGIONS_COUNT;
+             ++regionIndex)
+        {
+            const auto& region = regions[regionIndex];
+            REQUIRE(BoardGeometry::toRegionIndex(region->getRegionSpecificType(),
+                                                 static_cast<TileValueType>(region->getIndex())) ==
+                    regionIndex);
+        }
+        REQUIRE(regions[0] == solver.getAllSolverSubgrids()[0]);
+        REQUIRE(regions[9] == solver.getAllSolverHorizontalLines()[0]);
+        REQUIRE(regions[18] == solver.getAllSolverVerticalLines()[0]);
+    }
+    SECTION("Solver tiles are the tiles of the region")
+    {
+        for (const auto& region : solver.getAllRegions())
+        {
+            const auto& solverTiles = region->getSolverTiles();
+            REQUIRE(solverTiles.size() == region->getTiles().size());
+            for (size_t i = 0; i < solverTiles.size(); ++i)
+            {
+                REQUIRE(solverTiles[i] == region->getTiles()[i]);
+                REQUIRE(solverTiles[i] == solver(BoardGeometry::toCoordinates(region->getTileIndexes()[i])));
+            }
+        }
+    }
+    SECTION("Solver tiles are kept when the region is moved")
+    {
+        SolverLine line(&solver, LineOrientation::VERTICAL, 4);
+        const auto solverTiles = line.getSolverTiles();
+        SolverLine lineMoved(std::move(line));
+        REQUIRE(lineMoved.getSolverTiles() == solverTiles);
+        REQUIRE(line.getSolverTiles().empty());
+    }
+}
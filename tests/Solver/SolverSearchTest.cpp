@@ -0,0 +1,79 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "Solver/Solver.hpp"
+
+#include <algorithm>
+#include <string>
+
+namespace
+{
+bool isValidSolution(const std::string& puzzle, const std::string& solution)
+{
+    if (solution.size() != 81 || solution.find('.') != std::string::npos)
+    {
+        return false;
+    }
+    for (size_t i = 0; i < puzzle.size(); ++i)
+    {
+        if (puzzle[i] != '0' && puzzle[i] != '.' && puzzle[i] != solution[i])
+        {
+            return false;
+        }
+    }
+    for (size_t i = 0; i < 9; ++i)
+    {
+        std::string row, col, subgrid;
+        for (size_t j = 0; j < 9; ++j)
+        {
+            row += solution[i * 9 + j];
+            col += solution[j * 9 + i];
+            subgrid += solution[((i / 3) * 3 + j / 3) * 9 + (i % 3) * 3 + j % 3];
+        }
+        for (auto* region : {&row, &col, &subgrid})
+        {
+            std::sort(region->begin(), region->end());
+            if (*region != "123456789")
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+} // namespace
+
+TEST_CASE("Test Solver search fallback", "[SolverSearch]")
+{
+    const std::string puzzle =
+        "800000000003600000070090200050007000000045700000100030001000068008500010090000400";
+    const std::string solution =
+        "812753649943682175675491283154237896369845721287169534521974368438526917796318452";
+
+    SECTION("Techniques alone stall")
+    {
+        Solver solver(puzzle);
+        solver.setSearchFallbackEnabled(false);
+        REQUIRE_FALSE(solver.trySolve());
+        REQUIRE(solver.getSearchStatistics().nodesCount == 0);
+    }
+    SECTION("Search finishes the board")
+    {
+        Solver solver(puzzle);
+        REQUIRE(solver.trySolve());
+        REQUIRE(solver.getValuesString() == solution);
+        REQUIRE(isValidSolution(puzzle, solver.getValuesString()));
+
+        const auto& statistics = solver.getSearchStatistics();
+        REQUIRE(statistics.nodesCount > 0);
+        REQUIRE(statistics.maxDepth > 0);
+        REQUIRE(statistics.maxTrailSize > 0);
+    }
+    SECTION("Statistics are reset when a board is loaded")
+    {
+        Solver solver(puzzle);
+        REQUIRE(solver.trySolve());
+        solver.loadBoard("530070000600195000098000060800060003400803001700020006060000280000419005000080079");
+        REQUIRE(solver.trySolve());
+        REQUIRE(solver.getSearchStatistics().nodesCount == 0);
+    }
+}
@@ -0,0 +1,51 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "Solver/Solver.hpp"
+#include "Solver/SolverRegions.hpp"
+#include "Solver/SolverTile.hpp"
+
+TEST_CASE("Test Solver state", "[SolverState]")
+{
+    Solver solver("530070000600195000098000060800060003400803001700020006060000280000419005000080079");
+    solver.computeAllSuggestions();
+
+    const auto state = solver.getState();
+    const auto& tile = solver(0, 2);
+    REQUIRE(state.suggestions.tilesSuggestions[BoardGeometry::toTileIndex(0, 2)] == tile->getSuggestions());
+
+    const auto& horizontalLine = *tile->getSolverHorizontalLine();
+    const auto horizontalLineIndex = BoardGeometry::toRegionIndex(RegionSpecificType::HORIZONTAL_LINE, 0);
+    for (TileValueType value = 1; value <= 9; ++value)
+    {
+        REQUIRE(state.suggestions.regionsSuggestionsQuan[horizontalLineIndex].getSuggestionsQuantityFor(
+                    value) == horizontalLine.getSuggestionsQuanFor(value));
+    }
+
+    SECTION("Restoring the state undoes changes")
+    {
+        const auto originalSuggestions = tile->getSuggestions();
+        const auto originalQuantity = horizontalLine.getSuggestionsQuanFor(originalSuggestions.front());
+
+        tile->setValue(originalSuggestions.front());
+        REQUIRE(tile->hasValue());
+        REQUIRE(tile->getSuggestions().empty());
+
+        solver.setState(state);
+        REQUIRE_FALSE(tile->hasValue());
+        REQUIRE(tile->getSuggestions() == originalSuggestions);
+        REQUIRE(horizontalLine.getSuggestionsQuanFor(originalSuggestions.front()) == originalQuantity);
+    }
+    SECTION("State can be moved between solvers")
+    {
+        Solver other;
+        other.setState(state);
+        for (TileValueType row = 0; row < 9; ++row)
+        {
+            for (TileValueType col = 0; col < 9; ++col)
+            {
+                REQUIRE(other(row, col)->getValue() == solver(row, col)->getValue());
+                REQUIRE(other(row, col)->getSuggestions() == solver(row, col)->getSuggestions());
+            }
+        }
+    }
+}
@@ -0,0 +1,22 @@
+#ifndef __SOLVERTESTUTILS_H__
+#define __SOLVERTESTUTILS_H__
+
+#include "Solver/Solver.hpp"
+#include "Solver/SolverTile.hpp"
+
+// leaves the value only in the given columns (1 to 9) of the row
+inline void keepValueInColumns(Solver& solver,
+                               const TileValueType value,
+                               const TileValueType row,
+                               const Suggestions& cols)
+{
+    for (TileValueType col = 0; col < 9; ++col)
+    {
+        if (!cols.contains(col + 1))
+        {
+            solver(row, col)->removeSuggestion(value);
+        }
+    }
+}
+
+#endif // __SOLVERTESTUTILS_H__
@@ -0,0 +1,209 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "Solver/Solver.hpp"
+#include "Solver/SolverRegions.hpp"
+#include "Solver/SolverTile.hpp"
+
+#include <stdexcept>
+
+namespace
+{
+void requireSameState(const Solver& solver, const SolverState& state)
+{
+    const auto current = solver.getState();
+    REQUIRE(current.grid.values == state.grid.values);
+    REQUIRE(current.suggestions.tilesSuggestions == state.suggestions.tilesSuggestions);
+    for (BoardGeometry::RegionIndex regionIndex = 0; regionIndex < BoardGeometry::REGIONS_COUNT; ++regionIndex)
+    {
+        const auto& currentQuan = current.suggestions.regionsSuggestionsQuan[regionIndex];
+        const auto& expectedQuan = state.suggestions.regionsSuggestionsQuan[regionIndex];
+        for (TileValueType value = 1; value <= 9; ++value)
+        {
+            REQUIRE(currentQuan.getSuggestionsQuantityFor(value) ==
+                    expectedQuan.getSuggestionsQuantityFor(value));
+        }
+        REQUIRE(currentQuan.getSuggestionsWithQuantityEqualTo(1) ==
+                expectedQuan.getSuggestionsWithQuantityEqualTo(1));
+        REQUIRE(currentQuan.getSuggestionsWithQuantityEqualTo(2) ==
+                expectedQuan.getSuggestionsWithQuantityEqualTo(2));
+    }
+    REQUIRE(current.suggestions.valuesPositions == state.suggestions.valuesPositions);
+    REQUIRE(current.suggestions.bivalueTiles == state.suggestions.bivalueTiles);
+}
+
+// the indexes kept by the tiles must match the ones computed again from the suggestions
+void requireIndexesInSync(const Solver& solver)
+{
+    ValuesPositions valuesPositions;
+    BivalueTiles bivalueTiles;
+    const auto& tilesSuggestions = solver.getTilesSuggestions();
+    for (BoardGeometry::TileIndex tileIndex = 0; tileIndex < BoardGeometry::TILES_COUNT; ++tileIndex)
+    {
+        for (const auto value : tilesSuggestions[tileIndex]) { valuesPositions.add(tileIndex, value); }
+        bivalueTiles.update(tileIndex, Suggestions{}, tilesSuggestions[tileIndex]);
+    }
+    REQUIRE(solver.getValuesPositions() == valuesPositions);
+    REQUIRE(solver.getBivalueTiles() == bivalueTiles);
+}
+
+SolverTilePtr findEmptyTile(const Solver& solver, const TileValueType from = 0)
+{
+    for (TileValueType i = from; i < 81; ++i)
+    {
+        if (!solver(i / 9, i % 9)->hasValue())
+        {
+            return solver(i / 9, i % 9);
+        }
+    }
+    return nullptr;
+}
+} // namespace
+
+TEST_CASE("Test Solver checkpoints", "[SolverTrail]")
+{
+    Solver solver("530070000600195000098000060800060003400803001700020006060000280000419005000080079");
+    solver.computeAllSuggestions();
+    const auto initialState = solver.getState();
+
+    const auto tile = findEmptyTile(solver);
+    REQUIRE(tile != nullptr);
+    REQUIRE(solver.getOpenCheckpointsCount() == 0);
+
+    SECTION("Rollback undoes values and suggestions")
+    {
+        const auto checkpoint = solver.checkpoint();
+        REQUIRE(solver.getOpenCheckpointsCount() == 1);
+
+        const auto value = tile->getSuggestions().front();
+        tile->setValue(value);
+        const auto removedValue = solver(8, 0)->getSuggestions().front();
+        solver(8, 0)->removeSuggestion(removedValue);
+        solver(8, 0)->addSuggestion(removedValue);
+        solver(8, 0)->removeSuggestion(removedValue);
+
+        solver.rollback(checkpoint);
+        REQUIRE(solver.getOpenCheckpointsCount() == 0);
+        REQUIRE_FALSE(tile->hasValue());
+        requireSameState(solver, initialState);
+    }
+    SECTION("Nested checkpoints")
+    {
+        const auto outer = solver.checkpoint();
+        tile->setValue(tile->getSuggestions().front());
+        const auto afterOuterChange = solver.getState();
+
+        const auto secondTile = findEmptyTile(solver);
+        const auto inner = solver.checkpoint();
+        REQUIRE(solver.getOpenCheckpointsCount() == 2);
+        secondTile->setValue(secondTile->getSuggestions().front());
+
+        SECTION("Rolling back the inner checkpoint keeps the outer changes")
+        {
+            solver.rollback(inner);
+            requireSameState(solver, afterOuterChange);
+
+            solver.rollback(outer);
+            requireSameState(solver, initialState);
+        }
+        SECTION("Committed changes are undone by the outer checkpoint")
+        {
+            solver.commit(inner);
+            REQUIRE(secondTile->hasValue());
+            REQUIRE(solver.getOpenCheckpointsCount() == 1);
+
+            solver.rollback(outer);
+            requireSameState(solver, initialState);
+        }
+        SECTION("Checkpoints are closed innermost first")
+        {
+            REQUIRE_THROWS_AS(solver.rollback(outer), std::invalid_argument);
+            REQUIRE_THROWS_AS(solver.commit(outer), std::invalid_argument);
+            // nothing was undone
+            REQUIRE(secondTile->hasValue());
+        }
+    }
+    SECTION("Commit keeps the changes")
+    {
+        const auto checkpoint = solver.checkpoint();
+        const auto value = tile->getSuggestions().front();
+        tile->setValue(value);
+        solver.commit(checkpoint);
+
+        REQUIRE(solver.getOpenCheckpointsCount() == 0);
+        REQUIRE(tile->getValue() == value);
+        REQUIRE_THROWS_AS(solver.rollback(checkpoint), std::invalid_argument);
+    }
+    SECTION("Changes are not recorded without a checkpoint")
+    {
+        tile->setValue(tile->getSuggestions().front());
+        const auto checkpoint = solver.checkpoint();
+        solver.rollback(checkpoint);
+        REQUIRE(tile->hasValue());
+    }
+    SECTION("Recomputing the suggestions is undone by a rollback")
+    {
+        tile->removeSuggestion(tile->getSuggestions().front());
+        const auto beforeRecompute = solver.getState();
+
+        const auto checkpoint = solver.checkpoint();
+        solver.computeAllSuggestions(true);
+        requireSameState(solver, initialState);
+        requireIndexesInSync(solver);
+
+        solver.rollback(checkpoint);
+        requireSameState(solver, beforeRecompute);
+    }
+    SECTION("Setting the state discards the checkpoints")
+    {
+        solver.checkpoint();
+        solver.setState(initialState);
+        REQUIRE(solver.getOpenCheckpointsCount() == 0);
+    }
+}
+
+TEST_CASE("Test Solver indexes", "[SolverTrail]")
+{
+    Solver solver("530070000600195000098000060800060003400803001700020006060000280000419005000080079");
+    solver.computeAllSuggestions();
+    requireIndexesInSync(solver);
+    REQUIRE_FALSE(solver.getBivalueTiles().all.empty());
+    const auto initialState = solver.getState();
+
+    const auto checkpoint = solver.checkpoint();
+    const auto& tile = solver(0, 2);
+    const auto& suggestions = tile->getSuggestions();
+    tile->removeAllSuggestionsExceptFrom(Suggestions{suggestions.front(), suggestions.back()});
+    REQUIRE(solver.getBivalueTiles().all.contains(tile->getIndex()));
+    requireIndexesInSync(solver);
+
+    tile->setValue(tile->getSuggestions().front());
+    solver(4, 4)->removeSuggestion(solver(4, 4)->getSuggestions().back());
+    requireIndexesInSync(solver);
+    REQUIRE_FALSE(solver.getValuesPositions() == initialState.suggestions.valuesPositions);
+
+    solver.rollback(checkpoint);
+    requireSameState(solver, initialState);
+    requireIndexesInSync(solver);
+
+    solver.setState(SolverState{});
+    REQUIRE(solver.getValuesPositions() == ValuesPositions{});
+    REQUIRE(solver.getBivalueTiles() == BivalueTiles{});
+}
+
+TEST_CASE("Test Solver checkpoints while solving", "[SolverTrail]")
+{
+    // trial and error: set each suggestion of a tile, propagate with the techniques and undo
+    Solver solver("..9.....43..6..2......53.........81.16.4.5..223..8...9...21....94..36.........6..");
+    solver.computeAllSuggestions();
+    const auto initialState = solver.getState();
+
+    const auto tile = findEmptyTile(solver);
+    for (const auto value : Suggestions(tile->getSuggestions()))
+    {
+        const auto checkpoint = solver.checkpoint();
+        tile->setValue(value);
+        solver.trySolve();
+        solver.rollback(checkpoint);
+        requireSameState(solver, initialState);
+    }
+}
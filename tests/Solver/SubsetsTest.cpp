@@ -0,0 +1,117 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "Solver/Solver.hpp"
+#include "Solver/SolverRegions.hpp"
+#include "Solver/SolverTile.hpp"
+#include "Solver/Techniques/HiddenSubsets.hpp"
+#include "Solver/Techniques/NakedSubsets.hpp"
+#include "Solver/Techniques/Tools/SubsetFinder.hpp"
+
+TEST_CASE("Test naked subsets", "[Subsets]")
+{
+    Solver solver;
+    solver.computeAllSuggestions();
+    const auto& row = *solver.getAllSolverHorizontalLines()[0];
+
+    SECTION("Naked quad without smaller subsets")
+    {
+        solver(0, 0)->removeAllSuggestionsExceptFrom({1, 2});
+        solver(0, 1)->removeAllSuggestionsExceptFrom({2, 3});
+        solver(0, 2)->removeAllSuggestionsExceptFrom({3, 4});
+        solver(0, 3)->removeAllSuggestionsExceptFrom({1, 4});
+
+        const SubsetFinder finder(row);
+        REQUIRE_FALSE(finder.findNakedSubset(2).has_value());
+        REQUIRE_FALSE(finder.findNakedSubset(3).has_value());
+        const auto subset = finder.findNakedSubset(4);
+        REQUIRE(subset.has_value());
+        REQUIRE(subset->values == Suggestions{1, 2, 3, 4});
+        REQUIRE(subset->tiles == 0b1111);
+        REQUIRE(subset->getSizeName() == "Quad");
+
+        NakedSubsets nakedSubsets(solver);
+        REQUIRE(nakedSubsets.run());
+        for (TileValueType col = 4; col < 9; ++col)
+        {
+            REQUIRE(solver(0, col)->getSuggestions() == Suggestions{5, 6, 7, 8, 9});
+        }
+        REQUIRE(solver(0, 0)->getSuggestions() == Suggestions{1, 2});
+        REQUIRE(solver(1, 0)->hasSuggestion(1));
+        REQUIRE_FALSE(nakedSubsets.run());
+    }
+    SECTION("Naked pair")
+    {
+        solver(0, 4)->removeAllSuggestionsExceptFrom({7, 9});
+        solver(0, 8)->removeAllSuggestionsExceptFrom({7, 9});
+
+        const auto subset = SubsetFinder(row).findNakedSubset(2);
+        REQUIRE(subset.has_value());
+        REQUIRE(subset->values == Suggestions{7, 9});
+        REQUIRE(subset->tiles == ((1u << 4) | (1u << 8)));
+    }
+    SECTION("Subsets without eliminations are skipped")
+    {
+        for (TileValueType col = 0; col < 9; col += 2)
+        {
+            solver(0, col)->removeAllSuggestionsExceptFrom({1, 2, 3, 4, 5});
+        }
+        for (TileValueType col = 1; col < 9; col += 2)
+        {
+            solver(0, col)->removeAllSuggestionsExceptFrom({6, 7, 8, 9});
+        }
+        // {6, 7, 8, 9} is a naked quad, but no other tile of the row has those values
+        REQUIRE_FALSE(SubsetFinder(row).findNakedSubset(4).has_value());
+    }
+}
+
+TEST_CASE("Test hidden subsets", "[Subsets]")
+{
+    Solver solver;
+    solver.computeAllSuggestions();
+    const auto& row = *solver.getAllSolverHorizontalLines()[0];
+
+    const auto keepValueInColumns = [&](const TileValueType value, const Suggestions& cols) {
+        for (TileValueType col = 0; col < 9; ++col)
+        {
+            if (!cols.contains(col + 1))
+            {
+                solver(0, col)->removeSuggestion(value);
+            }
+        }
+    };
+
+    SECTION("Hidden pair")
+    {
+        keepValueInColumns(5, {8, 9});
+        keepValueInColumns(6, {8, 9});
+
+        HiddenSubsets hiddenSubsets(solver);
+        REQUIRE(hiddenSubsets.run());
+        REQUIRE(solver(0, 7)->getSuggestions() == Suggestions{5, 6});
+        REQUIRE(solver(0, 8)->getSuggestions() == Suggestions{5, 6});
+        REQUIRE(solver(0, 6)->getSuggestions() == Suggestions{1, 2, 3, 4, 7, 8, 9});
+        REQUIRE_FALSE(hiddenSubsets.run());
+    }
+    SECTION("Hidden quad without smaller subsets")
+    {
+        keepValueInColumns(1, {1, 2});
+        keepValueInColumns(2, {2, 3});
+        keepValueInColumns(3, {3, 4});
+        keepValueInColumns(4, {1, 4});
+
+        const SubsetFinder finder(row);
+        REQUIRE_FALSE(finder.findHiddenSubset(2).has_value());
+        REQUIRE_FALSE(finder.findHiddenSubset(3).has_value());
+        const auto subset = finder.findHiddenSubset(4);
+        REQUIRE(subset.has_value());
+        REQUIRE(subset->values == Suggestions{1, 2, 3, 4});
+        REQUIRE(subset->tiles == 0b1111);
+
+        HiddenSubsets hiddenSubsets(solver);
+        REQUIRE(hiddenSubsets.run());
+        for (TileValueType col = 0; col < 4; ++col)
+        {
+            REQUIRE(solver(0, col)->getSuggestions().size() == 2);
+        }
+    }
+}
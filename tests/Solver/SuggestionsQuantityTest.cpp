@@ -0,0 +1,45 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "Solver/SuggestionsQuantity.hpp"
+
+TEST_CASE("Test SuggestionsQuantity counters", "[SuggestionsQuantity]")
+{
+    SuggestionsQuantity suggestionsQuan;
+    REQUIRE(suggestionsQuan.getValidSuggestions().empty());
+    REQUIRE(suggestionsQuan.getSuggestionsWithQuantityEqualTo(0) == Suggestions::allValues());
+
+    suggestionsQuan.addSuggestion(3);
+    suggestionsQuan.addSuggestion(5);
+    suggestionsQuan.addSuggestion(5);
+    suggestionsQuan.addSuggestion(7);
+    suggestionsQuan.addSuggestion(7);
+    suggestionsQuan.addSuggestion(7);
+
+    REQUIRE(suggestionsQuan.getSuggestionsQuantityFor(3) == 1);
+    REQUIRE(suggestionsQuan.getSuggestionsQuantityFor(5) == 2);
+    REQUIRE(suggestionsQuan.getSuggestionsQuantityFor(7) == 3);
+    REQUIRE(suggestionsQuan.getSuggestionsQuantityFor(1) == 0);
+
+    SECTION("Masks follow the counters")
+    {
+        REQUIRE(suggestionsQuan.getValidSuggestions() == Suggestions{3, 5, 7});
+        REQUIRE(suggestionsQuan.getSuggestionsWithQuantityEqualTo(1) == Suggestions{3});
+        REQUIRE(suggestionsQuan.getSuggestionsWithQuantityEqualTo(2) == Suggestions{5});
+        REQUIRE(suggestionsQuan.getSuggestionsWithQuantityEqualTo(3) == Suggestions{7});
+        REQUIRE(suggestionsQuan.getSuggestionsWithQuantityGreaterThan(1) == Suggestions{5, 7});
+        REQUIRE(suggestionsQuan.getSuggestionsWithQuantityGreaterThan(2) == Suggestions{7});
+        REQUIRE(suggestionsQuan.getSuggestionsWithQuantityLessThan(2) ==
+                Suggestions::allValues() - Suggestions{5, 7});
+    }
+    SECTION("Removing suggestions moves values between masks")
+    {
+        suggestionsQuan.removeSuggestion(7);
+        suggestionsQuan.removeSuggestion(5);
+        suggestionsQuan.removeSuggestion(3);
+
+        REQUIRE(suggestionsQuan.getValidSuggestions() == Suggestions{5, 7});
+        REQUIRE(suggestionsQuan.getSuggestionsWithQuantityEqualTo(1) == Suggestions{5});
+        REQUIRE(suggestionsQuan.getSuggestionsWithQuantityEqualTo(2) == Suggestions{7});
+        REQUIRE(suggestionsQuan.getSuggestionsWithQuantityEqualTo(3).empty());
+    }
+}
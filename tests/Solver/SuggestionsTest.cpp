@@ -0,0 +1,79 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "Solver/Suggestions.hpp"
+
+#include <vector>
+
+TEST_CASE("Test Suggestions creation", "[Suggestions]")
+{
+    SECTION("Empty suggestions")
+    {
+        const Suggestions suggestions;
+        REQUIRE(suggestions.empty());
+        REQUIRE(suggestions.size() == 0);
+        REQUIRE(suggestions.getMask() == 0);
+        REQUIRE(suggestions.begin() == suggestions.end());
+    }
+    SECTION("Suggestions from initializer list")
+    {
+        const Suggestions suggestions{1, 5, 9};
+        REQUIRE(suggestions.size() == 3);
+        REQUIRE(suggestions.getMask() == 0b100010001);
+        REQUIRE(suggestions.contains(1));
+        REQUIRE(suggestions.contains(5));
+        REQUIRE(suggestions.contains(9));
+        REQUIRE_FALSE(suggestions.contains(2));
+        REQUIRE(suggestions.front() == 1);
+        REQUIRE(suggestions.back() == 9);
+    }
+    SECTION("Suggestions from iterator range")
+    {
+        const std::vector<TileValueType> values{3, 3, 7};
+        const Suggestions suggestions(values.begin(), values.end());
+        REQUIRE(suggestions == Suggestions{3, 7});
+    }
+    SECTION("All values")
+    {
+        const auto suggestions = Suggestions::allValues();
+        REQUIRE(suggestions.size() == 9);
+        for (TileValueType value = 1; value <= 9; ++value) { REQUIRE(suggestions.contains(value)); }
+    }
+}
+
+TEST_CASE("Test Suggestions manipulation", "[Suggestions]")
+{
+    Suggestions suggestions;
+
+    REQUIRE(suggestions.insert(4));
+    REQUIRE_FALSE(suggestions.insert(4));
+    REQUIRE(suggestions.insert(2));
+    REQUIRE(suggestions.size() == 2);
+
+    REQUIRE(suggestions.erase(4));
+    REQUIRE_FALSE(suggestions.erase(4));
+    REQUIRE(suggestions == Suggestions{2});
+
+    suggestions.clear();
+    REQUIRE(suggestions.empty());
+}
+
+TEST_CASE("Test Suggestions iteration", "[Suggestions]")
+{
+    const Suggestions suggestions{8, 2, 6, 1};
+    const std::vector<TileValueType> values(suggestions.cbegin(), suggestions.cend());
+    REQUIRE(values == std::vector<TileValueType>{1, 2, 6, 8});
+}
+
+TEST_CASE("Test Suggestions set operations", "[Suggestions]")
+{
+    const Suggestions first{1, 2, 3};
+    const Suggestions second{2, 3, 4};
+
+    REQUIRE((first | second) == Suggestions{1, 2, 3, 4});
+    REQUIRE((first & second) == Suggestions{2, 3});
+    REQUIRE((first - second) == Suggestions{1});
+    REQUIRE(first.intersects(second));
+    REQUIRE_FALSE(first.intersects(Suggestions{7, 8}));
+    REQUIRE(first.containsAll(Suggestions{1, 3}));
+    REQUIRE_FALSE(first.containsAll(second));
+}
@@ -0,0 +1,59 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "Solver/Solver.hpp"
+
+TEST_CASE("Test Technique statistics", "[TechniqueStatistics]")
+{
+    if constexpr (!TECHNIQUE_STATISTICS_ENABLED)
+    {
+        return;
+    }
+
+    // resolvido só com as técnicas
+    const std::string board =
+        ".7...51.6.6.1....8....8..4.....43...9...614......9..5.5.43...9.7..4..53......8...";
+    Solver solver(board);
+    solver.countSolutions();
+    const auto candidatesCount = solver.getCandidatesCount();
+    const auto emptyTilesCount = 81 - solver.getValuesCount();
+
+    REQUIRE(solver.trySolve());
+    REQUIRE(solver.getSearchStatistics().nodesCount == 0);
+
+    const auto report = solver.getTechniquesReport();
+    REQUIRE_FALSE(report.techniques.empty());
+    REQUIRE(report.techniques.front().techniqueName == "SinglesTile");
+
+    SECTION("Counters are consistent")
+    {
+        for (const auto& technique : report.techniques)
+        {
+            const auto& statistics = technique.statistics;
+            REQUIRE(statistics.analyzePassesCount <= statistics.analyzeCallsCount);
+            REQUIRE(statistics.performSuccessesCount <= statistics.analyzePassesCount);
+            REQUIRE(statistics.getHitRate() >= 0.0);
+            REQUIRE(statistics.getHitRate() <= 1.0);
+        }
+        REQUIRE(report.techniques.front().statistics.analyzeCallsCount > 0);
+        REQUIRE(report.techniques.front().statistics.analyzeTime.count() > 0);
+        REQUIRE(report.techniques.front().statistics.getHitRate() > 0.0);
+    }
+    SECTION("Every change is attributed to a technique")
+    {
+        const auto total = report.getTotal();
+        REQUIRE(total.placedValuesCount == emptyTilesCount);
+        REQUIRE(total.eliminatedCandidatesCount == candidatesCount);
+        REQUIRE(solver.getCandidatesCount() == 0);
+    }
+    SECTION("The report is printable")
+    {
+        const auto reportString = report.toString();
+        REQUIRE(reportString.find("SinglesTile") != std::string::npos);
+        REQUIRE(reportString.find("total") != std::string::npos);
+    }
+    SECTION("Loading a board resets the statistics")
+    {
+        solver.loadBoard(board);
+        REQUIRE(solver.getTechniquesReport().getTotal().analyzeCallsCount == 0);
+    }
+}
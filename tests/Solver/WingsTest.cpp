@@ -0,0 +1,106 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "Solver/Solver.hpp"
+#include "Solver/SolverTile.hpp"
+#include "Solver/Techniques/Tools/WingFinder.hpp"
+#include "Solver/Techniques/WWing.hpp"
+#include "Solver/Techniques/XYWing.hpp"
+#include "Solver/Techniques/XYZWing.hpp"
+
+#include <set>
+
+TEST_CASE("Test bivalue tiles", "[Wings]")
+{
+    std::set<size_t> pairIndexes;
+    for (TileValueType first = 1; first <= 9; ++first)
+    {
+        for (TileValueType second = first + 1; second <= 9; ++second)
+        {
+            const auto pairIndex = BivalueTiles::toPairIndex(Suggestions{first, second});
+            REQUIRE(pairIndex < BivalueTiles::PAIRS_COUNT);
+            pairIndexes.insert(pairIndex);
+        }
+    }
+    REQUIRE(pairIndexes.size() == BivalueTiles::PAIRS_COUNT);
+
+    Solver solver;
+    solver.computeAllSuggestions();
+    REQUIRE(solver.getBivalueTiles().all.empty());
+    const auto& tile = solver(0, 2);
+    tile->removeAllSuggestionsExceptFrom({3, 7});
+    REQUIRE(solver.getBivalueTiles().all == TileMask{tile->getIndex()});
+    REQUIRE(solver.getBivalueTiles().getTiles({3, 7}) == TileMask{tile->getIndex()});
+    tile->removeSuggestion(7);
+    REQUIRE(solver.getBivalueTiles().all.empty());
+}
+
+TEST_CASE("Test Wings", "[Wings]")
+{
+    Solver solver;
+    solver.computeAllSuggestions();
+
+    SECTION("XY-Wing")
+    {
+        solver(0, 0)->removeAllSuggestionsExceptFrom({1, 2});
+        solver(0, 4)->removeAllSuggestionsExceptFrom({1, 3});
+        solver(4, 0)->removeAllSuggestionsExceptFrom({2, 3});
+
+        const auto wing = WingFinder(solver).findXYWing();
+        REQUIRE(wing.has_value());
+        REQUIRE(wing->getName() == "XY-Wing");
+        REQUIRE(wing->value == 3);
+        REQUIRE(wing->pivot == BoardGeometry::toTileIndex(0, 0));
+        REQUIRE(wing->eliminations == TileMask{BoardGeometry::toTileIndex(4, 4)});
+        REQUIRE_FALSE(WingFinder(solver).findXYZWing().has_value());
+        REQUIRE_FALSE(WingFinder(solver).findWWing().has_value());
+
+        XYWing xyWing(solver);
+        REQUIRE(xyWing.run());
+        REQUIRE_FALSE(solver(4, 4)->hasSuggestion(3));
+        REQUIRE(solver(4, 5)->hasSuggestion(3));
+        REQUIRE_FALSE(xyWing.run());
+    }
+    SECTION("XYZ-Wing")
+    {
+        solver(0, 0)->removeAllSuggestionsExceptFrom({1, 2, 3});
+        solver(0, 1)->removeAllSuggestionsExceptFrom({1, 3});
+        solver(1, 0)->removeAllSuggestionsExceptFrom({2, 3});
+
+        REQUIRE_FALSE(WingFinder(solver).findXYWing().has_value());
+
+        XYZWing xyzWing(solver);
+        REQUIRE(xyzWing.run());
+        for (const auto& [row, col] : {std::pair{0, 2}, {1, 1}, {1, 2}, {2, 0}, {2, 1}, {2, 2}})
+        {
+            REQUIRE_FALSE(solver(row, col)->hasSuggestion(3));
+        }
+        // fora do quadrado, os tiles não veem os três
+        REQUIRE(solver(0, 5)->hasSuggestion(3));
+        REQUIRE(solver(5, 0)->hasSuggestion(3));
+        REQUIRE_FALSE(xyzWing.run());
+    }
+    SECTION("W-Wing")
+    {
+        solver(0, 0)->removeAllSuggestionsExceptFrom({1, 2});
+        solver(4, 8)->removeAllSuggestionsExceptFrom({1, 2});
+        // na linha I o 1 só pode estar nas colunas 1 e 9
+        for (TileValueType col = 1; col < 8; ++col) { solver(8, col)->removeSuggestion(1); }
+
+        const auto wing = WingFinder(solver).findWWing();
+        REQUIRE(wing.has_value());
+        REQUIRE(wing->getName() == "W-Wing");
+        REQUIRE(wing->value == 2);
+        REQUIRE(wing->linkValue == 1);
+        REQUIRE(wing->link ==
+                std::array{BoardGeometry::toTileIndex(8, 0), BoardGeometry::toTileIndex(8, 8)});
+        REQUIRE(wing->eliminations ==
+                TileMask{BoardGeometry::toTileIndex(0, 8), BoardGeometry::toTileIndex(4, 0)});
+
+        WWing wWing(solver);
+        REQUIRE(wWing.run());
+        REQUIRE_FALSE(solver(0, 8)->hasSuggestion(2));
+        REQUIRE_FALSE(solver(4, 0)->hasSuggestion(2));
+        REQUIRE(solver(0, 8)->hasSuggestion(1));
+        REQUIRE_FALSE(wWing.run());
+    }
+}